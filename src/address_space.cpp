@@ -0,0 +1,121 @@
+#include "address_space.h"
+#include <iostream>
+#include <signal.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+AddressSpace* AddressSpace::active_ = NULL;
+sigjmp_buf AddressSpace::fault_jump_;
+uint32_t AddressSpace::fault_page_ = 0;
+
+
+AddressSpace::AddressSpace(int frames_fd, unsigned int page_stride_shift)
+{
+	frames_fd_ = frames_fd;
+	page_stride_shift_ = page_stride_shift;
+	page_stride_ = (size_t)1 << page_stride_shift;
+	num_pages_ = GUEST_PAGES; // so no guest address can land outside the reservation
+	base_ = NULL;
+	
+#if defined(__linux__)
+	void* reservation = mmap(NULL, num_pages_ * page_stride_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	
+	if (reservation == MAP_FAILED)
+	{
+		std::cout << "Cannot reserve address space" << std::endl;
+		abort();
+	}
+	
+	base_ = (types::Byte*)reservation;
+#endif
+}
+
+AddressSpace::~AddressSpace()
+{
+#if defined(__linux__)
+	munmap(base_, num_pages_ * page_stride_);
+#endif
+}
+
+bool AddressSpace::Supported()
+{
+#if defined(__linux__)
+	return true;
+#else
+	return false;
+#endif
+}
+
+void AddressSpace::Map(uint32_t page_num, uint32_t frame_index)
+{
+#if defined(__linux__)
+	void* page = mmap(base_ + page_num * page_stride_, page_stride_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, frames_fd_, (off_t)frame_index * page_stride_);
+	
+	if (page == MAP_FAILED)
+	{
+		std::cout << "Cannot map page " << page_num << std::endl;
+		abort();
+	}
+#endif
+}
+
+void AddressSpace::Unmap(uint32_t page_num)
+{
+#if defined(__linux__)
+	// replacing the page keeps the reservation intact
+	mmap(base_ + page_num * page_stride_, page_stride_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+#endif
+}
+
+void AddressSpace::Activate(AddressSpace* space)
+{
+	active_ = space;
+}
+
+sigjmp_buf& AddressSpace::FaultJump()
+{
+	return fault_jump_;
+}
+
+uint32_t AddressSpace::LastFaultPage()
+{
+	return fault_page_;
+}
+
+void AddressSpace::FaultHandler(int signal, siginfo_t* info, void* context)
+{
+	AddressSpace* space = active_;
+	types::Byte* address = (types::Byte*)info->si_addr;
+	
+	if (space == NULL || address < space->base_ || address >= space->base_ + space->num_pages_ * space->page_stride_)
+	{
+		// a genuine host crash. fall back to the default action and let the access fault again
+		struct sigaction action;
+		memset(&action, 0, sizeof(action));
+		action.sa_handler = SIG_DFL;
+		sigaction(SIGSEGV, &action, NULL);
+		return;
+	}
+	
+	fault_page_ = (address - space->base_) / space->page_stride_;
+	
+	siglongjmp(fault_jump_, 1);
+}
+
+bool AddressSpace::InstallFaultHandler()
+{
+#if defined(__linux__)
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = FaultHandler;
+	action.sa_flags = SA_SIGINFO | SA_NODEFER; // NODEFER so jumping out of the handler leaves SIGSEGV unblocked
+	sigemptyset(&action.sa_mask);
+	
+	return sigaction(SIGSEGV, &action, NULL) == 0;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,68 @@
+#ifndef ADDRESS_SPACE_H
+#define ADDRESS_SPACE_H
+
+#include <csetjmp>
+#include <signal.h>
+#include <cstdlib>
+#include <stdint.h>
+#include "types.h"
+#include "machine_config.h"
+
+// a process' logical address space backed by a host virtual memory reservation.
+// every guest page gets one host page in the reservation. resident pages are
+// mapped from the shared RAM frames file, non-resident pages stay PROT_NONE and
+// touching them raises SIGSEGV, which is turned back into a guest page fault
+class AddressSpace
+{
+private:
+	types::Byte* base_; // start of the reservation
+	size_t num_pages_;
+	
+	int frames_fd_; // file holding the RAM frames
+	unsigned int page_stride_shift_; // log2 host bytes per page, also the stride of frames in the frames file
+	size_t page_stride_;
+	
+	static AddressSpace* active_; // the space the running instruction touches
+	static sigjmp_buf fault_jump_;
+	static uint32_t fault_page_;
+	
+	static void FaultHandler(int signal, siginfo_t* info, void* context);
+	
+public:
+	static const uint32_t GUEST_PAGES = 0x10000 / Machine::FRAME_SIZE; // 16 bit logical addresses, pages above them are not mapped
+	
+	// reserves the whole 16 bit guest range
+	AddressSpace(int frames_fd, unsigned int page_stride_shift);
+	~AddressSpace();
+	
+	// true when host mapped execution is available on this platform
+	static bool Supported();
+	
+	// installs the SIGSEGV handler. call once before running mapped
+	static bool InstallFaultHandler();
+	
+	// maps RAM frame frame_index into guest page page_num
+	void Map(uint32_t page_num, uint32_t frame_index);
+	
+	// returns guest page page_num to PROT_NONE
+	void Unmap(uint32_t page_num);
+	
+	// host address of a logical address. no translation table, no validity check
+	types::Word* WordAt(uint32_t logical_address)
+	{
+		logical_address &= 0xFFFF; // guest addresses are 16 bits
+		
+		return (types::Word*)(base_ + (Machine::PageOf(logical_address) << page_stride_shift_) + Machine::OffsetOf(logical_address));
+	}
+	
+	// the space faults are attributed to while an instruction runs
+	static void Activate(AddressSpace* space);
+	
+	// jump target set by the CPU before running an instruction
+	static sigjmp_buf& FaultJump();
+	
+	// guest page of the last fault
+	static uint32_t LastFaultPage();
+};
+
+#endif // ADDRESS_SPACE_H
@@ -0,0 +1,68 @@
+#ifndef BLOCK_OPS_H
+#define BLOCK_OPS_H
+
+#include <stdint.h>
+#include "types.h"
+
+// host kernels of the block and vector instructions, run over the words of one frame at a time.
+// the loops are written for the compiler to vectorize. copies go upwards a word at a time, so
+// overlapping ranges behave the same however wide the host vectors are
+namespace block_ops
+{
+inline void Copy(const types::Word* source, types::Word* destination, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		destination[i] = source[i];
+	}
+}
+
+inline void Fill(types::Word value, types::Word* destination, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		destination[i] = value;
+	}
+}
+
+inline void Add(const types::Word* source, types::Word* destination, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		destination[i] += source[i];
+	}
+}
+
+// the reductions fold into what the register already holds, words compare unsigned like SLT
+inline types::Word Sum(const types::Word* words, uint32_t count, types::Word sum)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		sum += words[i];
+	}
+	
+	return sum;
+}
+
+inline types::Word Min(const types::Word* words, uint32_t count, types::Word min)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		min = words[i] < min ? words[i] : min;
+	}
+	
+	return min;
+}
+
+inline types::Word Max(const types::Word* words, uint32_t count, types::Word max)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		max = words[i] > max ? words[i] : max;
+	}
+	
+	return max;
+}
+}
+
+#endif // BLOCK_OPS_H
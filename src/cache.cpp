@@ -0,0 +1,255 @@
+#include "cache.h"
+
+Cache::Cache(CacheConfig config)
+{
+	ways_ = config.ways;
+	line_size_ = config.line_size;
+	latency_ = config.latency;
+	num_sets_ = config.size / (config.line_size * config.ways);
+	
+	if (num_sets_ == 0)
+	{
+		num_sets_ = 1;
+	}
+	
+	Line empty = {0, false, false, 0};
+	lines_.resize(num_sets_ * ways_, empty);
+	
+	use_clock_ = 0;
+}
+
+Cache::Line* Cache::Find(uint32_t address)
+{
+	uint32_t line_address = address / line_size_;
+	Line* set = &lines_[(line_address % num_sets_) * ways_];
+	
+	for (unsigned int way = 0; way < ways_; way++)
+	{
+		if (set[way].valid && set[way].line_address == line_address)
+		{
+			return &set[way];
+		}
+	}
+	
+	return NULL;
+}
+
+bool Cache::Access(uint32_t address, bool write, bool* victim_dirty, uint32_t* victim_address)
+{
+	use_clock_++;
+	*victim_dirty = false;
+	
+	Line* line = Find(address);
+	
+	if (line != NULL)
+	{
+		line->last_used = use_clock_;
+		line->dirty = line->dirty || write;
+		return true;
+	}
+	
+	// miss, replace the least recently used way
+	uint32_t line_address = address / line_size_;
+	Line* set = &lines_[(line_address % num_sets_) * ways_];
+	Line* victim = &set[0];
+	
+	for (unsigned int way = 0; way < ways_; way++)
+	{
+		if (!set[way].valid)
+		{
+			victim = &set[way];
+			break;
+		}
+		
+		if (set[way].last_used < victim->last_used)
+		{
+			victim = &set[way];
+		}
+	}
+	
+	if (victim->valid && victim->dirty)
+	{
+		*victim_dirty = true;
+		*victim_address = victim->line_address * line_size_;
+	}
+	
+	victim->line_address = line_address;
+	victim->valid = true;
+	victim->dirty = write;
+	victim->last_used = use_clock_;
+	
+	return false;
+}
+
+bool Cache::Invalidate(uint32_t address)
+{
+	Line* line = Find(address);
+	
+	if (line == NULL)
+	{
+		return false;
+	}
+	
+	line->valid = false;
+	return line->dirty;
+}
+
+bool Cache::IsDirty(uint32_t address)
+{
+	Line* line = Find(address);
+	
+	return line != NULL && line->dirty;
+}
+
+void Cache::Clean(uint32_t address)
+{
+	Line* line = Find(address);
+	
+	if (line != NULL)
+	{
+		line->dirty = false;
+	}
+}
+
+unsigned int Cache::GetLatency()
+{
+	return latency_;
+}
+
+unsigned int Cache::GetLineSize()
+{
+	return line_size_;
+}
+
+CacheHierarchy::CacheHierarchy(int num_cpus, CacheConfig l1, CacheConfig l2, unsigned int memory_latency)
+	: l2_(l2)
+{
+	for (int i = 0; i < num_cpus; i++)
+	{
+		l1i_.push_back(Cache(l1));
+		l1d_.push_back(Cache(l1));
+	}
+	
+	memory_latency_ = memory_latency;
+}
+
+unsigned int CacheHierarchy::AccessL2(uint32_t address, bool write, PCB* process)
+{
+	bool victim_dirty;
+	uint32_t victim_address;
+	
+	unsigned int cycles = l2_.GetLatency();
+	
+	if (l2_.Access(address, write, &victim_dirty, &victim_address))
+	{
+		process->cache_hits[PCB::L2]++;
+	}
+	else
+	{
+		process->cache_misses[PCB::L2]++;
+		cycles += memory_latency_; // fill from memory
+	}
+	
+	if (victim_dirty)
+	{
+		cycles += memory_latency_; // write the victim back to memory
+	}
+	
+	return cycles;
+}
+
+unsigned int CacheHierarchy::AccessL1(Cache& l1, int level, uint32_t address, bool write, PCB* process)
+{
+	bool victim_dirty;
+	uint32_t victim_address;
+	
+	unsigned int cycles = l1.GetLatency();
+	
+	if (l1.Access(address, write, &victim_dirty, &victim_address))
+	{
+		process->cache_hits[level]++;
+		return cycles;
+	}
+	
+	process->cache_misses[level]++;
+	
+	if (victim_dirty)
+	{
+		cycles += AccessL2(victim_address, true, process);
+	}
+	
+	// fill the line. the L2 copy only becomes dirty when the L1 line is written back
+	cycles += AccessL2(address, false, process);
+	
+	return cycles;
+}
+
+unsigned int CacheHierarchy::Snoop(int cpu_index, uint32_t address, bool write, PCB* process)
+{
+	unsigned int cycles = 0;
+	
+	for (int i = 0; i < l1d_.size(); i++)
+	{
+		if (i == cpu_index)
+		{
+			continue;
+		}
+		
+		// a modified copy elsewhere has to reach L2 first
+		if (l1d_[i].IsDirty(address))
+		{
+			cycles += AccessL2(address, true, process);
+			l1d_[i].Clean(address);
+		}
+		
+		// writes invalidate every other copy
+		if (write)
+		{
+			l1d_[i].Invalidate(address);
+			l1i_[i].Invalidate(address);
+		}
+	}
+	
+	return cycles;
+}
+
+unsigned int CacheHierarchy::Fetch(int cpu_index, uint32_t address, PCB* process)
+{
+	return AccessL1(l1i_[cpu_index], PCB::L1I, address, false, process);
+}
+
+unsigned int CacheHierarchy::Load(int cpu_index, uint32_t address, PCB* process)
+{
+	return Snoop(cpu_index, address, false, process) + AccessL1(l1d_[cpu_index], PCB::L1D, address, false, process);
+}
+
+unsigned int CacheHierarchy::Store(int cpu_index, uint32_t address, PCB* process)
+{
+	l1i_[cpu_index].Invalidate(address); // keep our own instruction cache coherent too
+	
+	return Snoop(cpu_index, address, true, process) + AccessL1(l1d_[cpu_index], PCB::L1D, address, true, process);
+}
+
+void CacheHierarchy::InvalidateRange(uint32_t address, unsigned int size)
+{
+	unsigned int line_size = l2_.GetLineSize();
+	
+	for (int i = 0; i < l1d_.size(); i++)
+	{
+		if (l1d_[i].GetLineSize() < line_size)
+		{
+			line_size = l1d_[i].GetLineSize();
+		}
+	}
+	
+	for (uint32_t line = address; line < address + size; line += line_size)
+	{
+		for (int i = 0; i < l1d_.size(); i++)
+		{
+			l1i_[i].Invalidate(line);
+			l1d_[i].Invalidate(line);
+		}
+		
+		l2_.Invalidate(line);
+	}
+}
@@ -0,0 +1,93 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <vector>
+#include <stdint.h>
+#include "pcb.h"
+
+struct CacheConfig
+{
+	unsigned int size; // in bytes
+	unsigned int ways;
+	unsigned int line_size; // in bytes
+	unsigned int latency; // cycles per access
+};
+
+// set associative cache timing model with LRU replacement.
+// only tags are kept, the data itself always lives in Memory
+class Cache
+{
+private:
+	struct Line
+	{
+		uint32_t line_address;
+		bool valid;
+		bool dirty;
+		unsigned long last_used;
+	};
+	
+	std::vector<Line> lines_; // num_sets_ * ways_, set major
+	unsigned int num_sets_;
+	unsigned int ways_;
+	unsigned int line_size_;
+	unsigned int latency_;
+	
+	unsigned long use_clock_;
+	
+	Line* Find(uint32_t address);
+	
+public:
+	Cache(CacheConfig config);
+	
+	// looks up an address, allocating it on a miss (write-allocate). writes mark the line dirty.
+	// returns true on a hit. if the allocation evicted a dirty line, victim_dirty is set and
+	// victim_address holds its address so it can be written back
+	bool Access(uint32_t address, bool write, bool* victim_dirty, uint32_t* victim_address);
+	
+	// drops the line holding the address. returns true if it was dirty
+	bool Invalidate(uint32_t address);
+	
+	// true if the address is cached and dirty
+	bool IsDirty(uint32_t address);
+	
+	// marks the line holding the address clean after it was written back
+	void Clean(uint32_t address);
+	
+	unsigned int GetLatency();
+	unsigned int GetLineSize();
+};
+
+// per-CPU L1 instruction and data caches over one shared L2, write-back and write-allocate at
+// every level. stores invalidate other CPUs' copies, and dirty copies held by other CPUs are
+// written back to L2 before they are read. every access returns the cycles it cost and counts
+// its hits and misses against the process
+class CacheHierarchy
+{
+private:
+	std::vector<Cache> l1i_;
+	std::vector<Cache> l1d_;
+	Cache l2_;
+	unsigned int memory_latency_;
+	
+	// cycles for an L2 access, including going to memory on a miss
+	unsigned int AccessL2(uint32_t address, bool write, PCB* process);
+	
+	// L1 access, falling through to L2 on a miss
+	unsigned int AccessL1(Cache& l1, int level, uint32_t address, bool write, PCB* process);
+	
+	// coherence traffic for an access by cpu_index. returns the cycles spent on write-backs
+	unsigned int Snoop(int cpu_index, uint32_t address, bool write, PCB* process);
+	
+public:
+	CacheHierarchy(int num_cpus, CacheConfig l1, CacheConfig l2, unsigned int memory_latency);
+	
+	// addresses are absolute, frame index * frame size + offset
+	unsigned int Fetch(int cpu_index, uint32_t address, PCB* process);
+	unsigned int Load(int cpu_index, uint32_t address, PCB* process);
+	unsigned int Store(int cpu_index, uint32_t address, PCB* process);
+	
+	// drops a range from every cache, for memory that was overwritten from disk
+	void InvalidateRange(uint32_t address, unsigned int size);
+};
+
+#endif // CACHE_H
@@ -0,0 +1,248 @@
+#include "compressed_swap.h"
+#include <iostream>
+#include <string.h>
+
+enum TAGS {ZERO, REPEAT, LITERAL};
+
+CompressedSwap::CompressedSwap(WriteBack& write_back, size_t budget)
+	: write_back_(write_back)
+{
+	budget_ = budget;
+	used_ = 0;
+	
+	stores_ = 0;
+	same_fill_stores_ = 0;
+	raw_stores_ = 0;
+	bytes_in_ = 0;
+	bytes_stored_ = 0;
+	hits_ = 0;
+	misses_ = 0;
+	demotions_ = 0;
+	max_used_ = 0;
+}
+
+void CompressedSwap::Compress(const types::Word* words, Entry& entry)
+{
+	bool same_fill = true;
+	
+	for (unsigned int i = 1; i < Machine::FRAME_WORDS && same_fill; i++)
+	{
+		same_fill = words[i] == words[0];
+	}
+	
+	if (same_fill)
+	{
+		entry.encoding = SAME_FILL;
+		entry.fill = words[0];
+		return;
+	}
+	
+	// tags first, four to a byte, then the literal words
+	const unsigned int tag_bytes = (Machine::FRAME_WORDS + 3) / 4;
+	entry.data.assign(tag_bytes, 0);
+	
+	for (unsigned int i = 0; i < Machine::FRAME_WORDS; i++)
+	{
+		TAGS tag = LITERAL;
+		
+		if (words[i] == 0)
+		{
+			tag = ZERO;
+		}
+		else if (i > 0 && words[i] == words[i - 1])
+		{
+			tag = REPEAT;
+		}
+		
+		entry.data[i / 4] |= tag << (2 * (i % 4));
+		
+		if (tag == LITERAL)
+		{
+			const uint8_t* bytes = (const uint8_t*)&words[i];
+			entry.data.insert(entry.data.end(), bytes, bytes + sizeof(types::Word));
+		}
+	}
+	
+	entry.encoding = PACKED;
+	
+	// incompressible, keep it as it is
+	if (entry.data.size() >= Machine::FRAME_SIZE)
+	{
+		entry.encoding = RAW;
+		entry.data.resize(Machine::FRAME_SIZE);
+		memcpy(entry.data.data(), words, Machine::FRAME_SIZE);
+	}
+}
+
+void CompressedSwap::Decompress(const Entry& entry, types::Word* words)
+{
+	switch (entry.encoding)
+	{
+		case SAME_FILL:
+		{
+			for (unsigned int i = 0; i < Machine::FRAME_WORDS; i++)
+			{
+				words[i] = entry.fill;
+			}
+			
+			break;
+		}
+		
+		case PACKED:
+		{
+			size_t literal = (Machine::FRAME_WORDS + 3) / 4;
+			
+			for (unsigned int i = 0; i < Machine::FRAME_WORDS; i++)
+			{
+				switch ((entry.data[i / 4] >> (2 * (i % 4))) & 0x3)
+				{
+					case ZERO:
+						words[i] = 0;
+						break;
+						
+					case REPEAT:
+						words[i] = words[i - 1];
+						break;
+						
+					case LITERAL:
+						memcpy(&words[i], &entry.data[literal], sizeof(types::Word));
+						literal += sizeof(types::Word);
+						break;
+				}
+			}
+			
+			break;
+		}
+		
+		case RAW:
+		{
+			memcpy(words, entry.data.data(), Machine::FRAME_SIZE);
+			break;
+		}
+	}
+}
+
+size_t CompressedSwap::Cost(const Entry& entry)
+{
+	return entry.data.size();
+}
+
+void CompressedSwap::Demote(std::list<Entry>::iterator entry)
+{
+	if (entry->dirty)
+	{
+		types::Word words[Machine::FRAME_WORDS];
+		Decompress(*entry, words);
+		
+		write_back_.Add(entry->process, entry->page_num, words);
+	}
+	
+	used_ -= Cost(*entry);
+	index_.erase(Key(entry->process, entry->page_num));
+	entries_.erase(entry);
+}
+
+void CompressedSwap::Store(PCB* process, uint32_t page_num, const types::Word* words, bool dirty)
+{
+	Entry entry;
+	entry.process = process;
+	entry.page_num = page_num;
+	entry.dirty = dirty;
+	Compress(words, entry);
+	
+	stores_++;
+	bytes_in_ += Machine::FRAME_SIZE;
+	bytes_stored_ += Cost(entry);
+	
+	if (entry.encoding == SAME_FILL)
+	{
+		same_fill_stores_++;
+	}
+	else if (entry.encoding == RAW)
+	{
+		raw_stores_++;
+	}
+	
+	// make room by demoting the least recently stored pages
+	while (!entries_.empty() && used_ + Cost(entry) > budget_)
+	{
+		Demote(--entries_.end());
+		demotions_++;
+	}
+	
+	if (Cost(entry) > budget_)
+	{
+		if (dirty)
+		{
+			write_back_.Add(process, page_num, words);
+		}
+		
+		demotions_++;
+		return;
+	}
+	
+	used_ += Cost(entry);
+	entries_.push_front(entry);
+	index_[Key(process, page_num)] = entries_.begin();
+	
+	if (used_ > max_used_)
+	{
+		max_used_ = used_;
+	}
+}
+
+bool CompressedSwap::Load(PCB* process, uint32_t page_num, types::Word* words, bool& dirty)
+{
+	std::map<Key, std::list<Entry>::iterator>::iterator found = index_.find(Key(process, page_num));
+	
+	if (found == index_.end())
+	{
+		misses_++;
+		return false;
+	}
+	
+	hits_++;
+	
+	std::list<Entry>::iterator entry = found->second;
+	Decompress(*entry, words);
+	dirty = entry->dirty;
+	
+	used_ -= Cost(*entry);
+	entries_.erase(entry);
+	index_.erase(found);
+	
+	return true;
+}
+
+bool CompressedSwap::Contains(PCB* process, uint32_t page_num)
+{
+	return index_.find(Key(process, page_num)) != index_.end();
+}
+
+void CompressedSwap::Flush(PCB* process)
+{
+	std::map<Key, std::list<Entry>::iterator>::iterator it = index_.lower_bound(Key(process, 0));
+	
+	while (it != index_.end() && it->first.first == process)
+	{
+		std::list<Entry>::iterator entry = it->second;
+		++it;
+		Demote(entry);
+	}
+}
+
+void CompressedSwap::PrintStatistics()
+{
+	std::cout << std::dec << "Compressed swap: " << stores_ << " pages stored (" << same_fill_stores_ << " same-filled, " << raw_stores_ << " incompressible), "
+			  << demotions_ << " demoted" << std::endl;
+	
+	if (stores_ > 0)
+	{
+		std::cout << "Compression ratio: " << (bytes_stored_ > 0 ? bytes_in_ / (double)bytes_stored_ : 0) << ", peak pool use: " << max_used_ << " of " << budget_ << " bytes" << std::endl;
+	}
+	
+	if (hits_ + misses_ > 0)
+	{
+		std::cout << "Swap-in hit rate: " << 100.0 * hits_ / (hits_ + misses_) << "% (" << hits_ << " hits, " << misses_ << " from disk)" << std::endl;
+	}
+}
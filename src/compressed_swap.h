@@ -0,0 +1,80 @@
+#ifndef COMPRESSED_SWAP_H
+#define COMPRESSED_SWAP_H
+
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+#include "write_back.h"
+#include "pcb.h"
+#include "types.h"
+
+// in-memory compressed store for evicted pages, between the memory manager and the disk, like zram.
+// pages of one repeated word keep only that word, others are packed with a 2 bit tag per word
+// (zero, repeat of the previous word or literal). once the compressed pages outgrow the budget
+// the least recently stored ones are demoted: dirty ones go to write-back, clean ones are dropped
+class CompressedSwap
+{
+private:
+	enum ENCODINGS {SAME_FILL, PACKED, RAW};
+	
+	struct Entry
+	{
+		PCB* process;
+		uint32_t page_num;
+		bool dirty;
+		ENCODINGS encoding;
+		types::Word fill; // SAME_FILL
+		std::vector<uint8_t> data; // PACKED tags then literals, or the RAW words
+	};
+	
+	typedef std::pair<PCB*, uint32_t> Key;
+	
+	WriteBack& write_back_;
+	size_t budget_; // bytes
+	size_t used_;
+	
+	std::list<Entry> entries_; // most recently stored first
+	std::map<Key, std::list<Entry>::iterator> index_;
+	
+	// statistics
+	unsigned long stores_;
+	unsigned long same_fill_stores_;
+	unsigned long raw_stores_;
+	unsigned long bytes_in_; // uncompressed
+	unsigned long bytes_stored_; // after compression
+	unsigned long hits_;
+	unsigned long misses_;
+	unsigned long demotions_;
+	size_t max_used_;
+	
+	static void Compress(const types::Word* words, Entry& entry);
+	static void Decompress(const Entry& entry, types::Word* words);
+	
+	// bytes an entry holds against the budget. same-filled pages live in the index alone
+	static size_t Cost(const Entry& entry);
+	
+	// queues the entry for write-back if it is dirty and drops it
+	void Demote(std::list<Entry>::iterator entry);
+	
+public:
+	CompressedSwap(WriteBack& write_back, size_t budget);
+	
+	// takes a page's Machine::FRAME_WORDS words, demoting older pages if over budget.
+	// clean pages are kept too, so they come back without a disk read
+	void Store(PCB* process, uint32_t page_num, const types::Word* words, bool dirty);
+	
+	// hands back and forgets a stored page, and whether it still differs from the disk image.
+	// false if it is not here, it is on disk then
+	bool Load(PCB* process, uint32_t page_num, types::Word* words, bool& dirty);
+	
+	bool Contains(PCB* process, uint32_t page_num);
+	
+	// demotes all of a process' pages
+	void Flush(PCB* process);
+	
+	void PrintStatistics();
+};
+
+#endif // COMPRESSED_SWAP_H
@@ -1,12 +1,275 @@
 #include "cpu.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <math.h>
 #include "metrics.h"
+#include "isa.h"
+#include "address_space.h"
+#include "block_ops.h"
 
-CPU::CPU(MemManager* mem_manager)
+// guest memory access policies the interpreter is instantiated on.
+// Load/Store return false when the page is not resident. Span gives the block instructions
+// a host pointer to count words that lie in one page, NULL when it is not resident. the caller
+// keeps count inside the page, so only the cache model needs count and write
+
+// software translation through the process' page table
+struct TranslatedAccess
+{
+	MemManager* mmu;
+	PCB::PageTable* page_table;
+	
+	uint32_t Clamp(uint32_t logical_address)
+	{
+		return logical_address;
+	}
+	
+	bool Fetch(uint32_t logical_address, types::Word& word)
+	{
+		return Load(logical_address, word);
+	}
+	
+	bool Load(uint32_t logical_address, types::Word& word)
+	{
+		uint32_t absolute_address = mmu->GetEffectiveAddress(logical_address, *page_table);
+		
+		if (absolute_address == 0xFFFFFFFF)
+		{
+			return false;
+		}
+		
+		word = mmu->FetchWord(absolute_address);
+		return true;
+	}
+	
+	bool Store(uint32_t logical_address, types::Word word)
+	{
+		uint32_t absolute_address = mmu->GetEffectiveAddress(logical_address, *page_table);
+		
+		if (absolute_address == 0xFFFFFFFF)
+		{
+			return false;
+		}
+		
+		mmu->StoreWord(absolute_address, word);
+		return true;
+	}
+	
+	types::Word* Span(uint32_t logical_address, uint32_t, bool)
+	{
+		uint32_t absolute_address = mmu->GetEffectiveAddress(logical_address, *page_table);
+		
+		return absolute_address == 0xFFFFFFFF ? NULL : mmu->WordPointer(absolute_address);
+	}
+};
+
+// direct access through the process' host address space. non-resident pages
+// fault in hardware and come back through the SIGSEGV handler instead
+struct MappedAccess
+{
+	AddressSpace* space;
+	
+	uint32_t Clamp(uint32_t logical_address)
+	{
+		return logical_address & 0xFFFF; // WordAt wraps the same way
+	}
+	
+	bool Fetch(uint32_t logical_address, types::Word& word)
+	{
+		return Load(logical_address, word);
+	}
+	
+	// addresses past the 16 bit window fault, and the process goes on through its page table
+	bool Load(uint32_t logical_address, types::Word& word)
+	{
+		if (logical_address > 0xFFFF)
+		{
+			return false;
+		}
+		
+		word = *space->WordAt(logical_address);
+		return true;
+	}
+	
+	bool Store(uint32_t logical_address, types::Word word)
+	{
+		if (logical_address > 0xFFFF)
+		{
+			return false;
+		}
+		
+		*space->WordAt(logical_address) = word;
+		return true;
+	}
+	
+	types::Word* Span(uint32_t logical_address, uint32_t, bool)
+	{
+		return logical_address > 0xFFFF ? NULL : space->WordAt(logical_address);
+	}
+};
+
+// verified jobs. the verifier proved every fetch stays inside the code, every data access inside
+// the image and that the code is never stored to, and the whole footprint is resident before the
+// job runs, so there is no validity check
+struct UncheckedAccess
+{
+	MemManager* mmu;
+	PCB::PageTable* page_table;
+	
+	uint32_t Clamp(uint32_t logical_address)
+	{
+		return logical_address;
+	}
+	
+	bool Fetch(uint32_t logical_address, types::Word& word)
+	{
+		word = mmu->FetchWord(mmu->GetFrameAddress((*page_table)[Machine::PageOf(logical_address)]) | Machine::OffsetOf(logical_address));
+		return true;
+	}
+	
+	bool Load(uint32_t logical_address, types::Word& word)
+	{
+		return Fetch(logical_address, word);
+	}
+	
+	bool Store(uint32_t logical_address, types::Word word)
+	{
+		mmu->StoreWord(mmu->GetFrameAddress((*page_table)[Machine::PageOf(logical_address)]) | Machine::OffsetOf(logical_address), word);
+		return true;
+	}
+	
+	types::Word* Span(uint32_t logical_address, uint32_t, bool)
+	{
+		return mmu->WordPointer(mmu->GetFrameAddress((*page_table)[Machine::PageOf(logical_address)]) | Machine::OffsetOf(logical_address));
+	}
+};
+
+// charges every access that reaches memory through another policy to the cache model
+template<typename Inner>
+struct TimedAccess
+{
+	Inner inner;
+	CacheHierarchy* caches;
+	PCB* process;
+	int cpu_index;
+	
+	uint32_t Clamp(uint32_t logical_address)
+	{
+		return inner.Clamp(logical_address);
+	}
+	
+	// caches are indexed by absolute address, frame index * frame size + offset
+	uint32_t AbsoluteAddress(uint32_t logical_address)
+	{
+		logical_address = inner.Clamp(logical_address);
+		return (process->page_table[Machine::PageOf(logical_address)] << Machine::FRAME_SHIFT) | Machine::OffsetOf(logical_address);
+	}
+	
+	bool Fetch(uint32_t logical_address, types::Word& word)
+	{
+		if (!inner.Fetch(logical_address, word))
+		{
+			return false;
+		}
+		
+		process->cycles += caches->Fetch(cpu_index, AbsoluteAddress(logical_address), process);
+		return true;
+	}
+	
+	bool Load(uint32_t logical_address, types::Word& word)
+	{
+		if (!inner.Load(logical_address, word))
+		{
+			return false;
+		}
+		
+		process->cycles += caches->Load(cpu_index, AbsoluteAddress(logical_address), process);
+		return true;
+	}
+	
+	bool Store(uint32_t logical_address, types::Word word)
+	{
+		if (!inner.Store(logical_address, word))
+		{
+			return false;
+		}
+		
+		process->cycles += caches->Store(cpu_index, AbsoluteAddress(logical_address), process);
+		return true;
+	}
+	
+	// every word of the span is charged
+	types::Word* Span(uint32_t logical_address, uint32_t count, bool write)
+	{
+		types::Word* words = inner.Span(logical_address, count, write);
+		
+		if (words == NULL)
+		{
+			return NULL;
+		}
+		
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t absolute_address = AbsoluteAddress(logical_address + i * sizeof(types::Word));
+			process->cycles += write ? caches->Store(cpu_index, absolute_address, process) : caches->Load(cpu_index, absolute_address, process);
+		}
+		
+		return words;
+	}
+};
+
+// counts each instruction fetched for the guest profiler. a page fault later in the instruction
+// takes the count back, see CPU::ProfileFault
+template<typename Inner>
+struct ProfiledAccess
+{
+	Inner inner;
+	PCB* process;
+	
+	uint32_t Clamp(uint32_t logical_address)
+	{
+		return inner.Clamp(logical_address);
+	}
+	
+	bool Fetch(uint32_t logical_address, types::Word& word)
+	{
+		if (!inner.Fetch(logical_address, word))
+		{
+			return false;
+		}
+		
+		uint32_t index = logical_address / sizeof(types::Word);
+		
+		if (index < process->pc_executions.size())
+		{
+			process->pc_executions[index]++;
+		}
+		
+		return true;
+	}
+	
+	bool Load(uint32_t logical_address, types::Word& word)
+	{
+		return inner.Load(logical_address, word);
+	}
+	
+	bool Store(uint32_t logical_address, types::Word word)
+	{
+		return inner.Store(logical_address, word);
+	}
+	
+	types::Word* Span(uint32_t logical_address, uint32_t count, bool write)
+	{
+		return inner.Span(logical_address, count, write);
+	}
+};
+
+CPU::CPU(MemManager* mem_manager, int index)
 {
 	mem_manager_ = mem_manager;
+	index_ = index;
 	current_process_ = NULL;
+	pipeline_ = NULL;
 }
 
 CPU::~CPU()
@@ -17,6 +280,11 @@ void CPU::SetCurrentProcess(PCB* process)
 {
 	current_process_ = process;
 	current_process_->status = PCB::RUNNING;
+	
+	if (pipeline_ != NULL)
+	{
+		pipeline_->Flush();
+	}
 }
 
 PCB* CPU::GetCurrentProcess()
@@ -24,37 +292,374 @@ PCB* CPU::GetCurrentProcess()
 	return current_process_;
 }
 
+void CPU::SetPipeline(Pipeline* pipeline)
+{
+	pipeline_ = pipeline;
+}
+
 void CPU::Execute()
 {
+	Run(1);
+}
+
+unsigned long CPU::Run(unsigned long budget)
+{
+	if (current_process_->replaying)
+	{
+		return Replay(budget);
+	}
+	
+	if (current_process_->address_space != NULL)
+	{
+		return RunMapped(budget);
+	}
+	
+	if (current_process_->verified)
+	{
+		UncheckedAccess access = {mem_manager_, &current_process_->page_table};
+		return Dispatch(access, budget);
+	}
+	
+	if (current_process_->native != NULL)
+	{
+		return RunNative(budget);
+	}
+	
+	TranslatedAccess access = {mem_manager_, &current_process_->page_table};
+	return Dispatch(access, budget);
+}
+
+template<typename Access>
+unsigned long CPU::Dispatch(Access& access, unsigned long budget)
+{
+	if (!current_process_->pc_executions.empty())
+	{
+		ProfiledAccess<Access> profiled = {access, current_process_};
+		return Time(profiled, budget);
+	}
+	
+	return Time(access, budget);
+}
+
+template<typename Access>
+unsigned long CPU::Time(Access& access, unsigned long budget)
+{
+	if (mem_manager_->GetCacheHierarchy() != NULL)
+	{
+		TimedAccess<Access> timed = {access, mem_manager_->GetCacheHierarchy(), current_process_, index_};
+		return Issue(timed, budget);
+	}
+	
+	return Issue(access, budget);
+}
+
+template<typename Access>
+unsigned long CPU::Issue(Access& access, unsigned long budget)
+{
+	if (pipeline_ != NULL)
+	{
+		return Steps<Access, true>(access, budget);
+	}
+	
+	return Steps<Access, false>(access, budget);
+}
+
+template<typename Access, bool Pipelined>
+unsigned long CPU::Steps(Access& access, unsigned long budget)
+{
+	unsigned long ticks = 0;
 	
-	// determine if current page is valid
-	if (current_process_->page_table[current_process_->program_counter / mem_manager_->GetFrameSize()] == 0xFFFFFFFF)
+	while (ticks < budget && current_process_->status == PCB::RUNNING)
+	{
+		if constexpr (Pipelined)
+		{
+			uint32_t pc = current_process_->program_counter;
+			unsigned long instructions = current_process_->instructions;
+			unsigned long cycles = current_process_->cycles;
+			
+			Step(access);
+			
+			// faulting instructions did not retire, they run again once the page is in
+			if (current_process_->instructions != instructions)
+			{
+				pipeline_->Retire(*current_process_, pc, instruction_register_, current_process_->cycles - cycles - 1);
+			}
+		}
+		else
+		{
+			Step(access);
+		}
+		
+		ticks++;
+	}
+	
+	return ticks;
+}
+
+unsigned long CPU::RunMapped(unsigned long budget)
+{
+	volatile unsigned long ticks = 0; // survives the jump back from a fault
+	
+	AddressSpace::Activate(current_process_->address_space);
+	
+	MappedAccess access = {current_process_->address_space};
+	
+	while (ticks < budget && current_process_->status == PCB::RUNNING)
+	{
+		ticks = ticks + 1; // ++ on a volatile is deprecated
+		
+		// a fault on a PROT_NONE page jumps back here with the faulting guest page
+		if (sigsetjmp(AddressSpace::FaultJump(), 0) != 0)
+		{
+			AddressSpace::Activate(NULL);
+			
+			BlockOn(AddressSpace::LastFaultPage());
+			return ticks;
+		}
+		
+		Dispatch(access, 1);
+	}
+	
+	AddressSpace::Activate(NULL);
+	
+	return ticks;
+}
+
+unsigned long CPU::RunNative(unsigned long budget)
+{
+	TranslatedAccess access = {mem_manager_, &current_process_->page_table};
+	unsigned long ticks = 0;
+	
+	while (ticks < budget && current_process_->status == PCB::RUNNING && current_process_->native != NULL)
+	{
+		native::Context context = {current_process_, mem_manager_, 0, 0, 0};
+		int exit = current_process_->native(context, budget - ticks);
+		
+		ticks += context.ticks;
+		
+		switch (exit)
+		{
+			case native::FAULT:
+			{
+				PageFault(context.fault_address);
+				return ticks;
+			}
+			
+			case native::DIVIDE_BY_ZERO:
+			{
+				DivideByZero();
+				return ticks;
+			}
+			
+			case native::HALT:
+			{
+				current_process_->status = PCB::TERMINATED;
+				return ticks;
+			}
+			
+			case native::CODE_WRITTEN: // the translation no longer matches the code
+			{
+				current_process_->native = NULL;
+				break;
+			}
+			
+			case native::INTERPRET: // outside the code, or an instruction left to the interpreter
+			{
+				if (ticks < budget)
+				{
+					ticks += Dispatch(access, 1);
+				}
+				
+				break;
+			}
+		}
+	}
+	
+	if (ticks < budget && current_process_->status == PCB::RUNNING)
+	{
+		ticks += Dispatch(access, budget - ticks);
+	}
+	
+	return ticks;
+}
+
+void CPU::PageFault(uint32_t logical_address)
+{
+	BlockOn(Machine::PageOf(logical_address));
+}
+
+void CPU::BlockOn(uint32_t page)
+{
+	current_process_->status = PCB::BLOCKED;
+	current_process_->page_fault_index = page;
+	current_process_->page_faults++;
+	
+	if (!current_process_->replaying)
+	{
+		current_process_->paging_trace.push_back(PagingEvent{current_process_->instructions, page, true});
+	}
+	
+	ProfileFault(page);
+	std::cout << "PAGE FAULT" << std::endl;
+}
+
+unsigned long CPU::Replay(unsigned long budget)
+{
+	PCB& process = *current_process_;
+	unsigned long ticks = 0;
+	
+	while (ticks < budget && process.status == PCB::RUNNING)
+	{
+		if (process.replay_next < process.paging_trace.size() && process.paging_trace[process.replay_next].instructions == process.instructions)
+		{
+			PagingEvent& event = process.paging_trace[process.replay_next++];
+			
+			if (!event.fault)
+			{
+				process.dirty_pages[event.page] = true;
+				continue;
+			}
+			
+			// the faulting instruction takes its tick without retiring, as it did when it ran
+			BlockOn(event.page);
+			return ticks + 1;
+		}
+		
+		// straight to the next event, the budget or the end of the run
+		unsigned long until = process.replay_next < process.paging_trace.size() ? process.paging_trace[process.replay_next].instructions : process.replay_instructions;
+		unsigned long steps = std::min(budget - ticks, until - process.instructions);
+		
+		process.instructions += steps;
+		process.burst_length += steps;
+		process.cycles += steps;
+		ticks += steps;
+		
+		if (process.instructions == process.replay_instructions)
+		{
+			process.status = PCB::TERMINATED;
+		}
+	}
+	
+	return ticks;
+}
+
+void CPU::ProfileFault(uint32_t page)
+{
+	uint32_t index = current_process_->program_counter / sizeof(types::Word);
+	
+	if (index >= current_process_->pc_faults.size())
 	{
-		current_process_->status = PCB::BLOCKED;
-		current_process_->page_fault_index = current_process_->program_counter / mem_manager_->GetFrameSize();
-		std::cout << "PAGE FAULT" << std::endl;
 		return;
 	}
 	
-	// the CPU gets the absolulte address of the current instruction
-	program_counter_ = mem_manager_->GetEffectiveAddress(current_process_->program_counter, current_process_->page_table);
+	current_process_->pc_faults[index]++;
+	
+	// the instruction's own page was resident if it faulted on any other, so its fetch was counted
+	if (page != Machine::PageOf(current_process_->program_counter) && current_process_->pc_executions[index] > 0)
+	{
+		current_process_->pc_executions[index]--;
+	}
+}
+
+// words from the address to the end of its page
+static uint32_t WordsInPage(uint32_t logical_address)
+{
+	return (Machine::FRAME_SIZE - Machine::OffsetOf(logical_address)) / sizeof(types::Word);
+}
+
+template<typename Access>
+bool CPU::Block(Access& access, const isa::Instruction& instruction)
+{
+	types::Word* r = current_process_->registers.data();
+	bool has_source = instruction.opcode != isa::BFIL;
+	bool has_destination = instruction.opcode == isa::BCPY || instruction.opcode == isa::BFIL || instruction.opcode == isa::VADD;
+	
+	while (r[instruction.reg3] > 0)
+	{
+		uint32_t count = r[instruction.reg3];
+		const types::Word* source = NULL;
+		types::Word* destination = NULL;
+		
+		if (has_source)
+		{
+			count = std::min(count, WordsInPage(access.Clamp(r[instruction.reg1])));
+		}
+		
+		if (has_destination)
+		{
+			count = std::min(count, WordsInPage(access.Clamp(r[instruction.reg2])));
+		}
+		
+		if (has_source && (source = access.Span(r[instruction.reg1], count, false)) == NULL)
+		{
+			PageFault(r[instruction.reg1]);
+			return false;
+		}
+		
+		if (has_destination && (destination = access.Span(r[instruction.reg2], count, true)) == NULL)
+		{
+			PageFault(r[instruction.reg2]);
+			return false;
+		}
+		
+		switch (instruction.opcode)
+		{
+			case isa::BCPY: block_ops::Copy(source, destination, count); break;
+			case isa::BFIL: block_ops::Fill(r[instruction.reg1], destination, count); break;
+			case isa::VADD: block_ops::Add(source, destination, count); break;
+			case isa::VSUM: r[instruction.reg2] = block_ops::Sum(source, count, r[instruction.reg2]); break;
+			case isa::VMIN: r[instruction.reg2] = block_ops::Min(source, count, r[instruction.reg2]); break;
+			case isa::VMAX: r[instruction.reg2] = block_ops::Max(source, count, r[instruction.reg2]); break;
+		}
+		
+		if (has_source)
+		{
+			r[instruction.reg1] += count * sizeof(types::Word);
+		}
+		
+		if (has_destination)
+		{
+			current_process_->MarkDirty(Machine::PageOf(access.Clamp(r[instruction.reg2])));
+			r[instruction.reg2] += count * sizeof(types::Word);
+		}
+		
+		r[instruction.reg3] -= count;
+		
+		// a host mapped fault in the next page jumps out of the kernel, the progress must be in the registers by then
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
 	
-	// the CPU gets the instruction at the location of the program_counter_
-	instruction_register_ = mem_manager_->FetchWord(program_counter_);
+	return true;
+}
+
+void CPU::DivideByZero()
+{
+	current_process_->status = PCB::TERMINATED;
+	std::cout << "DIVIDE BY ZERO" << std::endl;
+}
+
+template<typename Access>
+void CPU::Step(Access& access)
+{
+	// the CPU gets the instruction at the location of the program counter
+	if (!access.Fetch(current_process_->program_counter, instruction_register_))
+	{
+		PageFault(current_process_->program_counter);
+		return;
+	}
 
 	// decode
-	uint8_t format = instruction_register_ >> 30; // front 2 bits
-	uint8_t opcode = (instruction_register_ >> 24) & 0b111111; // next 6 bits. cut off lower 24 bits and select the 6 remaining
+	const isa::Instruction instruction = isa::Decode(instruction_register_);
 	
-	switch (opcode)
+	switch (instruction.opcode)
 	{
 		case 0x0: // RD | Reads content of I/P buffer into a accumulator
 		{
 			current_process_->io_ops++;
 			
-			uint8_t reg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t reg2 = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t reg1 = instruction.reg1;
+			uint8_t reg2 = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (reg2 > 0)
 			{
@@ -62,18 +667,14 @@ void CPU::Execute()
 			}
 			
 			// read content
-			uint32_t absolute_address = mem_manager_->GetEffectiveAddress(address, current_process_->page_table);// ip buffer absolute address
+			types::Word content;
 			
-			if (absolute_address == 0xFFFFFFFF)
+			if (!access.Load(address, content))
 			{
-				current_process_->status = PCB::BLOCKED;
-				current_process_->page_fault_index = address / mem_manager_->GetFrameSize();
-				std::cout << "PAGE FAULT" << std::endl;
+				PageFault(address);
 				return;
 			}
 			
-			types::Word content = mem_manager_->FetchWord(absolute_address);
-			
 			current_process_->registers[reg1] = content;
 			
 			break;
@@ -83,96 +684,75 @@ void CPU::Execute()
 		{
 			current_process_->io_ops++;
 			 
-			uint8_t reg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t reg2 = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t reg1 = instruction.reg1;
+			uint8_t reg2 = instruction.reg2;
+			uint16_t address = instruction.address;
 			
-			uint32_t absolute_address;
+			uint32_t logical_address = address;
 			
 			if (address == 0)
 			{
-				absolute_address = mem_manager_->GetEffectiveAddress(current_process_->registers[reg2], current_process_->page_table);// op buffer absolute address
-				
-				if (absolute_address == 0xFFFFFFFF)
-				{
-					current_process_->status = PCB::BLOCKED;
-					current_process_->page_fault_index = (current_process_->registers[reg2]) / mem_manager_->GetFrameSize();
-					std::cout << "PAGE FAULT" << std::endl;
-					return;
-				}
+				logical_address = current_process_->registers[reg2]; // op buffer address
 			}
-			else
+			
+			if (!access.Store(logical_address, current_process_->registers[reg1]))
 			{
-				absolute_address = mem_manager_->GetEffectiveAddress(address, current_process_->page_table);// op buffer absolute address
-				
-				if (absolute_address == 0xFFFFFFFF)
-				{
-					current_process_->status = PCB::BLOCKED;
-					current_process_->page_fault_index = address / mem_manager_->GetFrameSize();
-					std::cout << "PAGE FAULT" << std::endl;
-					return;
-				}
+				PageFault(logical_address);
+				return;
 			}
 			
-			
-			mem_manager_->GetMemory()->Write(absolute_address, &current_process_->registers[reg1], sizeof(types::Word));
+			current_process_->MarkDirty(Machine::PageOf(access.Clamp(logical_address)));
 			
 			break;
 		}
 		
 		case 0x2: // ST | stores content of a reg. into an addresss
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			types::Word breg_content = current_process_->registers[breg];
 			types::Word dreg_content = current_process_->registers[dreg];
 			
-			address += dreg_content;
+			uint32_t logical_address = address + dreg_content; // 32 bits, like LW
 			
 			// write content
-			uint32_t absolute_address = mem_manager_->GetEffectiveAddress(address, current_process_->page_table);
-			
-			if (absolute_address == 0xFFFFFFFF)
+			if (!access.Store(logical_address, breg_content))
 			{
-				current_process_->status = PCB::BLOCKED;
-				current_process_->page_fault_index = address / mem_manager_->GetFrameSize();
-				std::cout << "PAGE FAULT" << std::endl;
+				PageFault(logical_address);
 				return;
 			}
 			
-			mem_manager_->GetMemory()->Write(absolute_address, &breg_content, sizeof(types::Word));
+			current_process_->MarkDirty(Machine::PageOf(access.Clamp(logical_address)));
 			
 			break;
 		}
 		
 		case 0x3: // LW | loads content of an address into a reg
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
-			uint32_t absolute_address = mem_manager_->GetEffectiveAddress(address + current_process_->registers[breg], current_process_->page_table);
+			uint32_t logical_address = address + current_process_->registers[breg];
+			types::Word content;
 			
-			if (absolute_address == 0xFFFFFFFF)
+			if (!access.Load(logical_address, content))
 			{
-				current_process_->status = PCB::BLOCKED;
-				current_process_->page_fault_index = (address + current_process_->registers[breg]) / mem_manager_->GetFrameSize();
-				std::cout << "PAGE FAULT" << std::endl;
+				PageFault(logical_address);
 				return;
 			}
 			
-			current_process_->registers[dreg] = mem_manager_->FetchWord(absolute_address);
+			current_process_->registers[dreg] = content;
 			
 			break;
 		}
-		
 		case 0x4: // MOV | transfers the content of one register into another
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[sreg1] = current_process_->registers[sreg2]; 
 			
@@ -181,9 +761,9 @@ void CPU::Execute()
 		
 		case 0x5: // ADD | adds content of two s-regs into d-reg
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] + current_process_->registers[sreg2]; 
 			
@@ -192,9 +772,9 @@ void CPU::Execute()
 		
 		case 0x6: // SUB | subtracts content of two s-regs into d-reg
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] - current_process_->registers[sreg2]; 
 			
@@ -203,9 +783,9 @@ void CPU::Execute()
 		
 		case 0x7: // MUL | multiplies content of two s-regs into d-reg
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] * current_process_->registers[sreg2]; 
 			
@@ -214,9 +794,15 @@ void CPU::Execute()
 		
 		case 0x8: // DIV | divides content of two s-regs into d-reg
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
+			
+			if (current_process_->registers[sreg2] == 0)
+			{
+				DivideByZero();
+				return;
+			}
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] / current_process_->registers[sreg2]; 
 			
@@ -225,9 +811,9 @@ void CPU::Execute()
 		
 		case 0x9: // AND | logical AND of two s-regs into d-reg
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] & current_process_->registers[sreg2]; 
 			
@@ -236,9 +822,9 @@ void CPU::Execute()
 		
 		case 0xA: // OR | logical OR of two s-regs into d-reg
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] | current_process_->registers[sreg2]; 
 			
@@ -247,9 +833,9 @@ void CPU::Execute()
 		
 		case 0xB: // MOVI | transfers address/data directly into a register
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			current_process_->registers[dreg] = address;
 			
@@ -258,9 +844,9 @@ void CPU::Execute()
 		
 		case 0xC: // ADDI | Adds a data value directly into the content of a register
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			current_process_->registers[dreg] += address;
 			
@@ -269,9 +855,9 @@ void CPU::Execute()
 		
 		case 0xD: // MULI | Multiplies a data value directly into the content of a register
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			current_process_->registers[dreg] *= address;
 			
@@ -280,9 +866,15 @@ void CPU::Execute()
 		
 		case 0xE: // DIVI | Divides a data value directly into the content of a register
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
+			
+			if (address == 0)
+			{
+				DivideByZero();
+				return;
+			}
 			
 			current_process_->registers[dreg] /= address;
 			
@@ -291,9 +883,9 @@ void CPU::Execute()
 		
 		case 0xF: // LDI | Loads a data/address directly into the content of a register
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			current_process_->registers[dreg] = address;
 			
@@ -302,9 +894,9 @@ void CPU::Execute()
 		
 		case 0x10: // SLT | Sets the D-reg to 1 if the first Sreg is less than the B-reg; 0 otherwise
 		{
-			uint8_t sreg1 = (instruction_register_ >> 20) & 0xF;
-			uint8_t sreg2 = (instruction_register_ >> 16) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 12) & 0xF;
+			uint8_t sreg1 = instruction.reg1;
+			uint8_t sreg2 = instruction.reg2;
+			uint8_t dreg = instruction.reg3;
 			
 			current_process_->registers[dreg] = current_process_->registers[sreg1] < current_process_->registers[sreg2] ? 1 : 0; 
 			
@@ -313,9 +905,9 @@ void CPU::Execute()
 		
 		case 0x11: // SLTI | Sets the D-reg to 1 if the first S-reg is less than a data; 0 otherwise
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			current_process_->registers[dreg] = current_process_->registers[breg] < address ? 1 : 0;
 			
@@ -328,6 +920,9 @@ void CPU::Execute()
 			// mem_manager_->Release(current_process_->page_table, ceil(current_process_->program_size / (float)mem_manager_->GetFrameSize()));
 			current_process_->status = PCB::TERMINATED;
 			// current_process_ = NULL;
+			current_process_->instructions++;
+			current_process_->burst_length++;
+			current_process_->cycles++;
 			return;
 		}
 		
@@ -338,7 +933,7 @@ void CPU::Execute()
 		
 		case 0x14: // JMP | Jumps to a specified location
 		{
-			uint16_t address = instruction_register_ & 0xFFFFFF;
+			uint16_t address = instruction.address;
 			
 			current_process_->program_counter = address - sizeof(types::Word); // subtract 4 cause program counter will always increment 4 a the end
 			
@@ -347,9 +942,9 @@ void CPU::Execute()
 		
 		case 0x15: // BEQ | Branches to an address when the content of B-reg = D-reg
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (current_process_->registers[breg] == current_process_->registers[dreg])
 			{
@@ -361,9 +956,9 @@ void CPU::Execute()
 		
 		case 0x16: // BNE | Branches to an address when the content of B-reg != D-reg
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (current_process_->registers[breg] != current_process_->registers[dreg])
 			{
@@ -375,9 +970,9 @@ void CPU::Execute()
 		
 		case 0x17: // BEZ | Branches to an address when the content of B-reg = 0
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (current_process_->registers[breg] == 0)
 			{
@@ -389,9 +984,9 @@ void CPU::Execute()
 		
 		case 0x18: // BNZ | Branches to an address when the content of B-reg != 0
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (current_process_->registers[breg] != 0)
 			{
@@ -403,9 +998,9 @@ void CPU::Execute()
 		
 		case 0x19: // BGZ | Branches to an address when the content of B-reg > 0
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (!(current_process_->registers[breg] & 0x80000000)) // not sure about this
 			{
@@ -417,9 +1012,9 @@ void CPU::Execute()
 		
 		case 0x1A: // BLZ | Branches to an address when the content of B-reg < 0
 		{
-			uint8_t breg = (instruction_register_ >> 20) & 0xF;
-			uint8_t dreg = (instruction_register_ >> 16) & 0xF;
-			uint16_t address = instruction_register_ & 0xFFFF;
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
 			
 			if (current_process_->registers[breg] & 0x80000000) // not sure about this
 			{
@@ -428,9 +1023,74 @@ void CPU::Execute()
 			
 			break;
 		}
+		
+		case 0x1B: // LUI | Loads a data value into the upper half of a register, the lower half cleared. with ADDI or a base register it reaches 32 bit addresses
+		{
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
+			
+			current_process_->registers[dreg] = (types::Word)address << 16;
+			
+			break;
+		}
+		
+		case 0x1C: // BCPY | copies reg3 words from the address in reg1 to the address in reg2
+		case 0x1D: // BFIL | fills reg3 words from the address in reg2 with the content of reg1
+		case 0x1E: // VADD | adds reg3 words from the address in reg1 into those from the address in reg2
+		case 0x1F: // VSUM | adds reg3 words from the address in reg1 into reg2
+		case 0x20: // VMIN | the least of reg2 and reg3 words from the address in reg1 into reg2
+		case 0x21: // VMAX | the greatest of reg2 and reg3 words from the address in reg1 into reg2
+		{
+			if (!Block(access, instruction))
+			{
+				return;
+			}
+			
+			break;
+		}
+		
+		case 0x22: // CSWP | swaps the word at reg1 + address with the next one if it is greater, sets reg2 to 1 if they were swapped; 0 otherwise
+		{
+			uint8_t breg = instruction.reg1;
+			uint8_t dreg = instruction.reg2;
+			uint16_t address = instruction.address;
+			
+			uint32_t logical_address = address + current_process_->registers[breg];
+			types::Word first;
+			types::Word second;
+			
+			if (!access.Load(logical_address, first))
+			{
+				PageFault(logical_address);
+				return;
+			}
+			
+			if (!access.Load(logical_address + sizeof(types::Word), second))
+			{
+				PageFault(logical_address + sizeof(types::Word));
+				return;
+			}
+			
+			current_process_->registers[dreg] = first > second ? 1 : 0;
+			
+			if (first > second)
+			{
+				access.Store(logical_address, second);
+				access.Store(logical_address + sizeof(types::Word), first);
+				
+				current_process_->MarkDirty(Machine::PageOf(access.Clamp(logical_address)));
+				current_process_->MarkDirty(Machine::PageOf(access.Clamp(logical_address + sizeof(types::Word))));
+			}
+			
+			break;
+		}
 	}
 	
 	//std::cout << std::hex << opcode << std::endl;
 	
 	current_process_->program_counter += sizeof(types::Word);
+	current_process_->instructions++;
+	current_process_->burst_length++;
+	current_process_->cycles++;
 }
\ No newline at end of file
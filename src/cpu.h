@@ -5,23 +5,75 @@
 #include "pcb.h"
 #include "types.h"
 #include "memory_manager.h"
+#include "pipeline.h"
+#include "isa.h"
 
 class CPU
 {
 private:
 	PCB* current_process_;
 	MemManager* mem_manager_;
-	uint32_t program_counter_; // absolute address
+	int index_; // which CPU this is
 	types::Word instruction_register_;
+	Pipeline* pipeline_; // optional timing model, NULL when off
+	
+	// executes one instruction, with guest memory reached through the given access policy
+	template<typename Access>
+	void Step(Access& access);
+	
+	// wraps the access policy in the guest profiler and the cache model when they are enabled, then runs
+	template<typename Access>
+	unsigned long Dispatch(Access& access, unsigned long budget);
+	
+	template<typename Access>
+	unsigned long Time(Access& access, unsigned long budget);
+	
+	// a block or vector instruction, a page of its range at a time. returns false if it faulted
+	template<typename Access>
+	bool Block(Access& access, const isa::Instruction& instruction);
+	
+	// runs the steps through the pipeline model when there is one
+	template<typename Access>
+	unsigned long Issue(Access& access, unsigned long budget);
+	
+	// steps until the budget runs out or the process stops running
+	template<typename Access, bool Pipelined>
+	unsigned long Steps(Access& access, unsigned long budget);
+	
+	// runs inside the process' host address space
+	unsigned long RunMapped(unsigned long budget);
+	
+	// runs the process' precompiled translation, interpreting whatever it hands back
+	unsigned long RunNative(unsigned long budget);
+	
+	// blocks the current process on the page holding the logical address
+	void PageFault(uint32_t logical_address);
+	void BlockOn(uint32_t page);
+	
+	// runs a memoized process through its recorded paging events without executing it
+	unsigned long Replay(unsigned long budget);
+	
+	// charges a page fault to the instruction that took it, if the process is profiled
+	void ProfileFault(uint32_t page);
+	
+	// terminates the current process, checked even for verified jobs
+	void DivideByZero();
 	
 public:
-	CPU(MemManager* mem_manager); // needs a pointer to the memory manager to fetch instructions
+	CPU(MemManager* mem_manager, int index); // needs a pointer to the memory manager to fetch instructions
 	~CPU();
 	
 	void SetCurrentProcess(PCB* process);
 	PCB* GetCurrentProcess();
 	
-	void Execute();
+	// attaches a pipeline timing model, it is flushed whenever a process is switched in
+	void SetPipeline(Pipeline* pipeline);
+	
+	void Execute(); // one instruction
+	
+	// executes up to budget instructions, stopping early once the process blocks or terminates.
+	// returns the ticks used, a faulting instruction takes a tick without retiring
+	unsigned long Run(unsigned long budget);
 
 };
 
@@ -14,13 +14,13 @@ public:
 	Disk(size_t size);
 	~Disk();
 	
-	// reads disk and stores it in the buffer
-	// needs the base address, pointer to the buffer, and number of bytes to be read ( must not exceed sizeof(buffer) )
+	// reads disk and stores it in the buffer. words on disk are big-endian, this is where they become host-native
+	// needs the base address, pointer to the buffer, and number of bytes to be read ( must not exceed sizeof(T) )
 	template<typename T>
 	void Read(unsigned int base_address, T* buffer, size_t size);
 	
 	// writes data to disk at the specified base address with the data given in the buffer
-	// needs the base address, pointer to the buffer, and number of bytes to be written ( must not exceed sizeof(buffer) )
+	// needs the base address, pointer to the buffer, and number of bytes to be written ( must not exceed sizeof(T) )
 	template<typename T>
 	void Write(unsigned int base_address, T* buffer, size_t size);
 	
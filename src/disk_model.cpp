@@ -0,0 +1,267 @@
+#include "disk_model.h"
+#include <iostream>
+#include <stdlib.h>
+
+DiskDevice::DiskDevice(DiskModelConfig config, POLICIES policy, int deadline_ticks)
+{
+	config_ = config;
+	policy_ = policy;
+	deadline_ticks_ = deadline_ticks;
+	
+	busy_until_ = 0;
+	head_ = 0;
+	moving_up_ = true;
+	
+	requests_ = 0;
+	writes_ = 0;
+	transfers_ = 0;
+	total_latency_ = 0;
+	max_latency_ = 0;
+	total_depth_ = 0;
+	max_depth_ = 0;
+}
+
+bool DiskDevice::ParsePolicy(std::string name, POLICIES& policy)
+{
+	const char* names[] = {"fcfs", "sstf", "scan", "cscan", "deadline"};
+	
+	for (int i = 0; i < 5; i++)
+	{
+		if (name == names[i])
+		{
+			policy = static_cast<POLICIES>(i);
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+void DiskDevice::Submit(IoRequest request, int now)
+{
+	request.submit_time = now;
+	request.deadline = now + deadline_ticks_;
+	
+	queue_.push_back(request);
+	
+	requests_++;
+	
+	if (request.write)
+	{
+		writes_++;
+	}
+	total_depth_ += queue_.size() + in_flight_.size();
+	
+	if (queue_.size() + in_flight_.size() > max_depth_)
+	{
+		max_depth_ = queue_.size() + in_flight_.size();
+	}
+}
+
+int DiskDevice::PickNext(int now)
+{
+	int next = 0;
+	
+	switch (policy_)
+	{
+		case FCFS:
+		{
+			break;
+		}
+		
+		case DEADLINE:
+		{
+			// the oldest request goes first once it is overdue, otherwise sweep like C-SCAN
+			if (queue_[0].deadline <= now)
+			{
+				break;
+			}
+		}
+		// fall through
+		
+		case CSCAN:
+		{
+			// nearest request ahead of the head, wrapping around to the lowest address
+			int lowest = 0;
+			next = -1;
+			
+			for (int i = 0; i < queue_.size(); i++)
+			{
+				if (queue_[i].disk_address < queue_[lowest].disk_address)
+				{
+					lowest = i;
+				}
+				
+				if (queue_[i].disk_address >= head_ && (next == -1 || queue_[i].disk_address < queue_[next].disk_address))
+				{
+					next = i;
+				}
+			}
+			
+			if (next == -1)
+			{
+				next = lowest;
+			}
+			
+			break;
+		}
+		
+		case SSTF:
+		{
+			for (int i = 1; i < queue_.size(); i++)
+			{
+				if (labs((long)queue_[i].disk_address - (long)head_) < labs((long)queue_[next].disk_address - (long)head_))
+				{
+					next = i;
+				}
+			}
+			
+			break;
+		}
+		
+		case SCAN:
+		{
+			// nearest request in the direction of travel, turning around at the last one
+			for (int pass = 0; pass < 2; pass++)
+			{
+				next = -1;
+				
+				for (int i = 0; i < queue_.size(); i++)
+				{
+					bool ahead = moving_up_ ? queue_[i].disk_address >= head_ : queue_[i].disk_address <= head_;
+					
+					if (ahead && (next == -1 || labs((long)queue_[i].disk_address - (long)head_) < labs((long)queue_[next].disk_address - (long)head_)))
+					{
+						next = i;
+					}
+				}
+				
+				if (next != -1)
+				{
+					break;
+				}
+				
+				moving_up_ = !moving_up_;
+			}
+			
+			break;
+		}
+	}
+	
+	return next;
+}
+
+int DiskDevice::ServiceTime(uint32_t disk_address, unsigned int size)
+{
+	if (config_.ssd)
+	{
+		return config_.access_latency + config_.transfer_per_word * ((size + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+	}
+	
+	int ticks = 0;
+	
+	long tracks = labs((long)(disk_address / config_.track_size) - (long)(head_ / config_.track_size));
+	
+	if (tracks > 0)
+	{
+		ticks += config_.seek_settle + config_.seek_per_track * tracks;
+	}
+	
+	ticks += config_.rotation / 2; // average rotational delay
+	ticks += (config_.rotation * size + config_.track_size - 1) / config_.track_size; // transfer
+	
+	return ticks;
+}
+
+void DiskDevice::Dispatch(int now)
+{
+	int next = PickNext(now);
+	
+	in_flight_.push_back(queue_[next]);
+	queue_.erase(queue_.begin() + next);
+	
+	uint32_t start = in_flight_[0].disk_address;
+	uint32_t end = start + in_flight_[0].size;
+	
+	// merge queued requests that extend the transfer on either side
+	bool merged = true;
+	
+	while (merged)
+	{
+		merged = false;
+		
+		for (int i = 0; i < queue_.size(); i++)
+		{
+			if (queue_[i].disk_address == end || queue_[i].disk_address + queue_[i].size == start)
+			{
+				if (queue_[i].disk_address == end)
+				{
+					end += queue_[i].size;
+				}
+				else
+				{
+					start = queue_[i].disk_address;
+				}
+				
+				in_flight_.push_back(queue_[i]);
+				queue_.erase(queue_.begin() + i);
+				merged = true;
+				break;
+			}
+		}
+	}
+	
+	busy_until_ = now + ServiceTime(start, end - start);
+	head_ = end;
+	transfers_++;
+}
+
+std::vector<IoRequest> DiskDevice::Complete(int now)
+{
+	std::vector<IoRequest> completed;
+	
+	if (!in_flight_.empty() && busy_until_ <= now)
+	{
+		for (int i = 0; i < in_flight_.size(); i++)
+		{
+			int latency = now - in_flight_[i].submit_time;
+			
+			total_latency_ += latency;
+			
+			if (latency > max_latency_)
+			{
+				max_latency_ = latency;
+			}
+		}
+		
+		completed.swap(in_flight_);
+	}
+	
+	if (in_flight_.empty() && !queue_.empty())
+	{
+		Dispatch(now);
+	}
+	
+	return completed;
+}
+
+bool DiskDevice::Idle()
+{
+	return queue_.empty() && in_flight_.empty();
+}
+
+int DiskDevice::BusyUntil()
+{
+	return in_flight_.empty() ? -1 : busy_until_;
+}
+
+void DiskDevice::PrintStatistics()
+{
+	std::cout << std::dec << "Disk: " << requests_ - writes_ << " page-in and " << writes_ << " write-back requests in " << transfers_ << " transfers" << std::endl;
+	
+	if (requests_ > 0)
+	{
+		std::cout << "Request latency (mean / max): " << total_latency_ / (double)requests_ << " / " << max_latency_ << std::endl
+				  << "Queue depth at submit (mean / max): " << total_depth_ / (double)requests_ << " / " << max_depth_ << std::endl;
+	}
+}
@@ -0,0 +1,94 @@
+#ifndef DISK_MODEL_H
+#define DISK_MODEL_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "pcb.h"
+
+struct DiskModelConfig
+{
+	bool ssd; // no seek or rotation, flat access latency
+	
+	// hard drive, all times in ticks
+	unsigned int track_size; // bytes per track
+	unsigned int seek_settle; // fixed cost of any seek
+	unsigned int seek_per_track;
+	unsigned int rotation; // one full revolution
+	
+	// solid state drive
+	unsigned int access_latency;
+	unsigned int transfer_per_word;
+};
+
+// a page-in waiting for the disk, or a write-back transfer
+struct IoRequest
+{
+	PCB* process;
+	uint32_t page_num;
+	uint32_t disk_address;
+	unsigned int size; // bytes
+	bool write; // nothing waits on a write, its data is already on disk
+	
+	int submit_time;
+	int deadline; // DEADLINE policy serves expired requests first
+};
+
+// disk device latency model with a request queue. one transfer is in flight at a time,
+// queued requests are ordered by the I/O scheduling policy and requests for adjacent
+// disk ranges are merged into one transfer
+class DiskDevice
+{
+public:
+	enum POLICIES {FCFS, SSTF, SCAN, CSCAN, DEADLINE};
+	
+private:
+	DiskModelConfig config_;
+	POLICIES policy_;
+	int deadline_ticks_;
+	
+	std::vector<IoRequest> queue_; // in arrival order
+	std::vector<IoRequest> in_flight_;
+	int busy_until_;
+	
+	uint32_t head_; // disk address under the head
+	bool moving_up_; // SCAN direction
+	
+	// statistics
+	unsigned long requests_;
+	unsigned long writes_;
+	unsigned long transfers_;
+	unsigned long total_latency_;
+	int max_latency_;
+	unsigned long total_depth_;
+	unsigned int max_depth_;
+	
+	// index in the queue of the request the policy serves next
+	int PickNext(int now);
+	
+	// ticks to move the head and transfer size bytes at disk_address
+	int ServiceTime(uint32_t disk_address, unsigned int size);
+	
+	// starts the next transfer, merging adjacent requests into it
+	void Dispatch(int now);
+	
+public:
+	DiskDevice(DiskModelConfig config, POLICIES policy, int deadline_ticks);
+	
+	// parses a policy name, returns false if it is unknown
+	static bool ParsePolicy(std::string name, POLICIES& policy);
+	
+	void Submit(IoRequest request, int now);
+	
+	// requests whose transfer has finished by now. starts the next transfer if the disk is free
+	std::vector<IoRequest> Complete(int now);
+	
+	bool Idle();
+	
+	// when the transfer in flight finishes, -1 if nothing is in flight
+	int BusyUntil();
+	
+	void PrintStatistics();
+};
+
+#endif // DISK_MODEL_H
@@ -0,0 +1,494 @@
+#include "distributed.h"
+#include <chrono>
+#include <climits>
+#include <deque>
+#include <iostream>
+#include <string.h>
+#include "cpu.h"
+#include "loader.h"
+#include "memory.h"
+#include "memory_manager.h"
+
+#if defined(__unix__)
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace distributed
+{
+
+enum MESSAGES
+{
+	REQUEST, // worker is idle
+	JOB, // index, id, priority, program size, input, output and temp buffer offsets, image words
+	RESULT, // index, status, instructions, page faults, I/O operations, ticks, image words. the worker is idle again
+	DONE // no more work
+};
+
+const unsigned int JOB_HEADER_WORDS = 7;
+const unsigned int RESULT_HEADER_WORDS = 6;
+
+struct Message
+{
+	uint32_t type;
+	std::vector<uint32_t> words;
+};
+
+#if defined(__unix__)
+static bool WriteAll(int fd, const void* buffer, size_t size)
+{
+	const char* cur = (const char*)buffer;
+	
+	while (size > 0)
+	{
+		ssize_t written = write(fd, cur, size);
+		
+		if (written <= 0)
+		{
+			return false;
+		}
+		
+		cur += written;
+		size -= written;
+	}
+	
+	return true;
+}
+
+static bool ReadAll(int fd, void* buffer, size_t size)
+{
+	char* cur = (char*)buffer;
+	
+	while (size > 0)
+	{
+		ssize_t count = read(fd, cur, size);
+		
+		if (count <= 0)
+		{
+			return false;
+		}
+		
+		cur += count;
+		size -= count;
+	}
+	
+	return true;
+}
+
+static bool Send(int fd, uint32_t type, const std::vector<uint32_t>& words)
+{
+	std::vector<uint32_t> buffer(2 + words.size());
+	buffer[0] = htonl(type);
+	buffer[1] = htonl(words.size());
+	
+	for (size_t i = 0; i < words.size(); i++)
+	{
+		buffer[2 + i] = htonl(words[i]);
+	}
+	
+	return WriteAll(fd, buffer.data(), buffer.size() * sizeof(uint32_t));
+}
+
+static bool Receive(int fd, Message& message)
+{
+	uint32_t header[2];
+	
+	if (!ReadAll(fd, header, sizeof(header)))
+	{
+		return false;
+	}
+	
+	message.type = ntohl(header[0]);
+	message.words.resize(ntohl(header[1]));
+	
+	if (!ReadAll(fd, message.words.data(), message.words.size() * sizeof(uint32_t)))
+	{
+		return false;
+	}
+	
+	for (size_t i = 0; i < message.words.size(); i++)
+	{
+		message.words[i] = ntohl(message.words[i]);
+	}
+	
+	return true;
+}
+
+static bool SocketAddress(std::string socket_path, sockaddr_un& address)
+{
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	
+	if (socket_path.size() >= sizeof(address.sun_path))
+	{
+		return false;
+	}
+	
+	strcpy(address.sun_path, socket_path.c_str());
+	return true;
+}
+
+// demand pages the job through to the end on a machine of its own. returns the ticks it took
+static unsigned long RunJob(Disk& disk, MemManager& mmu, CPU& cpu, PCB& job)
+{
+	unsigned long ticks = 0;
+	
+	cpu.SetCurrentProcess(&job);
+	
+	while (true)
+	{
+		ticks += cpu.Run(ULONG_MAX);
+		
+		if (job.status != PCB::BLOCKED)
+		{
+			break;
+		}
+		
+		loader::LoadPageToMemory(disk, mmu, &job, job.page_fault_index);
+		cpu.SetCurrentProcess(&job);
+	}
+	
+	// dirty pages go back into the image
+	for (uint32_t page = 0; page < Machine::PagesFor(job.program_size); page++)
+	{
+		if (job.page_table[page] != 0xFFFFFFFF && job.dirty_pages[page])
+		{
+			types::Word words[Machine::FRAME_WORDS];
+			loader::ReadPageFromMemory(mmu, &job, page, words);
+			loader::WritePageToDisk(disk, &job, page, words);
+		}
+	}
+	
+	mmu.Release(job.page_table);
+	
+	return ticks;
+}
+
+bool RunWorker(std::string socket_path)
+{
+	sockaddr_un address;
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	
+	if (fd < 0 || !SocketAddress(socket_path, address) || connect(fd, (sockaddr*)&address, sizeof(address)) != 0)
+	{
+		std::cout << "Cannot reach coordinator at " << socket_path << std::endl;
+		
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+		
+		return false;
+	}
+	
+	// the worker's own machine, one job at a time at the start of its disk
+	Disk disk(Machine::DISK_SIZE);
+	Memory ram(Machine::RAM_SIZE);
+	MemManager mmu(&ram);
+	CPU cpu(&mmu, 0);
+	
+	Message message;
+	bool connected = Send(fd, REQUEST, std::vector<uint32_t>());
+	
+	while (connected && Receive(fd, message) && message.type == JOB && message.words.size() >= JOB_HEADER_WORDS)
+	{
+		const std::vector<uint32_t>& words = message.words;
+		
+		PCB job;
+		job.id = words[1];
+		job.priority = words[2];
+		job.program_size = words[3];
+		job.input_buffer_offset = words[4];
+		job.output_buffer_offset = words[5];
+		job.temp_buffer_offset = words[6];
+		job.disk_address = 0;
+		job.SizePageFlags();
+		
+		unsigned int num_words = words.size() - JOB_HEADER_WORDS;
+		
+		for (unsigned int i = 0; i < num_words; i++)
+		{
+			disk.Write(i * sizeof(types::Word), &words[JOB_HEADER_WORDS + i], sizeof(types::Word));
+		}
+		
+		unsigned long ticks = RunJob(disk, mmu, cpu, job);
+		
+		std::vector<uint32_t> result(RESULT_HEADER_WORDS + num_words);
+		result[0] = words[0];
+		result[1] = job.status;
+		result[2] = job.instructions;
+		result[3] = job.page_faults;
+		result[4] = job.io_ops;
+		result[5] = ticks;
+		
+		for (unsigned int i = 0; i < num_words; i++)
+		{
+			disk.Read(i * sizeof(types::Word), &result[RESULT_HEADER_WORDS + i], sizeof(types::Word));
+		}
+		
+		connected = Send(fd, RESULT, result);
+	}
+	
+	close(fd);
+	return true;
+}
+
+bool Coordinate(Disk& disk, std::vector<PCB>& jobs, std::string socket_path, int local_workers)
+{
+	signal(SIGPIPE, SIG_IGN); // a worker that went away shows up as a failed send
+	
+	sockaddr_un address;
+	int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(socket_path.c_str());
+	
+	if (listener < 0 || !SocketAddress(socket_path, address) || bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 16) != 0)
+	{
+		std::cout << "Cannot listen on " << socket_path << std::endl;
+		
+		if (listener >= 0)
+		{
+			close(listener);
+		}
+		
+		return false;
+	}
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	
+	// local workers are forks of this process with their output discarded
+	std::cout.flush();
+	std::vector<pid_t> children;
+	
+	for (int i = 0; i < local_workers; i++)
+	{
+		pid_t pid = fork();
+		
+		if (pid == 0)
+		{
+			close(listener);
+			
+			int null_fd = open("/dev/null", O_WRONLY);
+			dup2(null_fd, STDOUT_FILENO);
+			
+			_exit(RunWorker(socket_path) ? 0 : 1);
+		}
+		
+		if (pid > 0)
+		{
+			children.push_back(pid);
+		}
+	}
+	
+	struct Worker
+	{
+		int fd; // -1 once disconnected
+		int job; // index of the job it is running, -1 if idle
+		unsigned int jobs_run;
+		unsigned long ticks;
+	};
+	
+	std::vector<Worker> workers;
+	std::deque<int> pending;
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		pending.push_back(i);
+	}
+	
+	size_t results = 0;
+	int live_children = children.size();
+	std::cout << "Coordinating " << jobs.size() << " jobs on " << socket_path << std::endl;
+	
+	while (results < jobs.size())
+	{
+		std::vector<pollfd> fds;
+		std::vector<int> fd_workers; // worker index per pollfd after the listener
+		
+		pollfd listen_fd = {listener, POLLIN, 0};
+		fds.push_back(listen_fd);
+		
+		for (int i = 0; i < workers.size(); i++)
+		{
+			if (workers[i].fd != -1)
+			{
+				pollfd worker_fd = {workers[i].fd, POLLIN, 0};
+				fds.push_back(worker_fd);
+				fd_workers.push_back(i);
+			}
+		}
+		
+		// with every local worker gone and nobody else connected the jobs can never finish
+		if (fd_workers.empty() && live_children > 0 && waitpid(-1, NULL, WNOHANG) > 0 && --live_children == 0)
+		{
+			std::cout << "All workers exited with " << jobs.size() - results << " jobs unfinished" << std::endl;
+			break;
+		}
+		
+		if (poll(fds.data(), fds.size(), 1000) <= 0)
+		{
+			continue;
+		}
+		
+		if (fds[0].revents & POLLIN)
+		{
+			int fd = accept(listener, NULL, NULL);
+			
+			if (fd >= 0)
+			{
+				Worker worker = {fd, -1, 0, 0};
+				workers.push_back(worker);
+			}
+		}
+		
+		for (int i = 1; i < fds.size(); i++)
+		{
+			if (fds[i].revents == 0)
+			{
+				continue;
+			}
+			
+			Worker& worker = workers[fd_workers[i - 1]];
+			Message message;
+			
+			if (!Receive(worker.fd, message))
+			{
+				// its job goes to someone else
+				if (worker.job != -1)
+				{
+					pending.push_front(worker.job);
+				}
+				
+				close(worker.fd);
+				worker.fd = -1;
+				continue;
+			}
+			
+			if (message.type == RESULT && message.words.size() >= RESULT_HEADER_WORDS && message.words[0] == worker.job)
+			{
+				PCB& job = jobs[worker.job];
+				const std::vector<uint32_t>& words = message.words;
+				
+				job.status = (PCB::STATUS)words[1];
+				job.instructions = words[2];
+				job.page_faults = words[3];
+				job.io_ops = words[4];
+				job.completion_time = words[5];
+				job.finish_time = words[5];
+				
+				for (unsigned int w = 0; w < words.size() - RESULT_HEADER_WORDS; w++)
+				{
+					disk.Write(job.disk_address + w * sizeof(types::Word), &words[RESULT_HEADER_WORDS + w], sizeof(types::Word));
+				}
+				
+				worker.job = -1;
+				worker.jobs_run++;
+				worker.ticks += words[5];
+				results++;
+			}
+			
+			if (worker.job != -1)
+			{
+				continue;
+			}
+			
+			// idle, hand out the next job
+			if (pending.empty())
+			{
+				Send(worker.fd, DONE, std::vector<uint32_t>());
+				close(worker.fd);
+				worker.fd = -1;
+				continue;
+			}
+			
+			int index = pending.front();
+			pending.pop_front();
+			
+			PCB& job = jobs[index];
+			std::vector<uint32_t> words(JOB_HEADER_WORDS + job.program_size / sizeof(types::Word));
+			words[0] = index;
+			words[1] = job.id;
+			words[2] = job.priority;
+			words[3] = job.program_size;
+			words[4] = job.input_buffer_offset;
+			words[5] = job.output_buffer_offset;
+			words[6] = job.temp_buffer_offset;
+			
+			for (unsigned int w = 0; w < words.size() - JOB_HEADER_WORDS; w++)
+			{
+				disk.Read(job.disk_address + w * sizeof(types::Word), &words[JOB_HEADER_WORDS + w], sizeof(types::Word));
+			}
+			
+			worker.job = index;
+			
+			if (!Send(worker.fd, JOB, words))
+			{
+				pending.push_front(index);
+				close(worker.fd);
+				worker.fd = -1;
+			}
+		}
+	}
+	
+	for (int i = 0; i < workers.size(); i++)
+	{
+		if (workers[i].fd != -1)
+		{
+			Send(workers[i].fd, DONE, std::vector<uint32_t>());
+			close(workers[i].fd);
+		}
+	}
+	
+	close(listener);
+	unlink(socket_path.c_str());
+	
+	for (int i = 0; i < children.size(); i++)
+	{
+		waitpid(children[i], NULL, 0);
+	}
+	
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	
+	// aggregate metrics
+	unsigned long instructions = 0;
+	unsigned long page_faults = 0;
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		instructions += jobs[i].instructions;
+		page_faults += jobs[i].page_faults;
+	}
+	
+	std::cout << std::dec << "Distributed " << results << " jobs over " << workers.size() << " workers in " << seconds * 1000 << " ms, "
+			  << instructions << " instructions and " << page_faults << " page faults" << std::endl
+			  << "Jobs / ticks per worker:";
+	
+	for (int i = 0; i < workers.size(); i++)
+	{
+		std::cout << " " << workers[i].jobs_run << " / " << workers[i].ticks << (i + 1 < workers.size() ? "," : "");
+	}
+	
+	std::cout << std::endl;
+	
+	return true;
+}
+#else
+bool RunWorker(std::string socket_path)
+{
+	std::cout << "Workers need Unix-domain sockets" << std::endl;
+	return false;
+}
+
+bool Coordinate(Disk& disk, std::vector<PCB>& jobs, std::string socket_path, int local_workers)
+{
+	std::cout << "Coordinator mode needs Unix-domain sockets" << std::endl;
+	return false;
+}
+#endif
+
+}
@@ -0,0 +1,24 @@
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include <string>
+#include <vector>
+#include "disk.h"
+#include "pcb.h"
+
+// coordinator/worker mode. the coordinator listens on a Unix-domain socket and hands whole jobs
+// to worker VM processes as they ask for work. each worker runs a job on its own machine and
+// sends back the job's image and metrics, which the coordinator writes to its disk.
+// every message is a type word, a length word and that many words, all 32 bits in network byte order
+namespace distributed
+{
+// runs every job on workers, forking local_workers of them and accepting any others that
+// connect to the socket. returns false if the socket could not be set up
+bool Coordinate(Disk& disk, std::vector<PCB>& jobs, std::string socket_path, int local_workers);
+
+// connects to a coordinator and runs the jobs it is given until it has no more. returns false
+// if the coordinator could not be reached
+bool RunWorker(std::string socket_path);
+}
+
+#endif // DISTRIBUTED_H
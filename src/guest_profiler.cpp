@@ -0,0 +1,190 @@
+#include "guest_profiler.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include "isa.h"
+
+namespace guest_profiler
+{
+
+void Enable(std::vector<PCB>& jobs)
+{
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		unsigned int code_words = jobs[i].input_buffer_offset / sizeof(types::Word);
+		
+		jobs[i].pc_executions.assign(code_words, 0);
+		jobs[i].pc_faults.assign(code_words, 0);
+	}
+}
+
+// the first instruction, branch targets and the instructions after branches
+static std::set<uint32_t> BlockLeaders(const std::vector<types::Word>& code)
+{
+	std::set<uint32_t> leaders;
+	leaders.insert(0);
+	
+	for (uint32_t i = 0; i < code.size(); i++)
+	{
+		const isa::Instruction instruction = isa::Decode(code[i]);
+		const isa::OpcodeInfo& info = isa::OPCODE_TABLE[instruction.opcode];
+		
+		if (info.branch || info.ends_program)
+		{
+			leaders.insert(i + 1);
+		}
+		
+		if (info.branch && instruction.address % sizeof(types::Word) == 0)
+		{
+			leaders.insert(instruction.address / sizeof(types::Word));
+		}
+	}
+	
+	return leaders;
+}
+
+bool Write(Disk& disk, std::vector<PCB>& jobs, std::string path)
+{
+	std::ofstream listing(path);
+	std::ofstream folded(path + ".folded");
+	
+	if (!listing.is_open() || !folded.is_open())
+	{
+		std::cout << "Cannot write guest profile " << path << std::endl;
+		return false;
+	}
+	
+	for (int j = 0; j < jobs.size(); j++)
+	{
+		PCB& job = jobs[j];
+		
+		std::vector<types::Word> code(job.pc_executions.size());
+		
+		for (uint32_t i = 0; i < code.size(); i++)
+		{
+			disk.Read(job.disk_address + i * sizeof(types::Word), &code[i], sizeof(types::Word));
+		}
+		
+		std::set<uint32_t> leaders = BlockLeaders(code);
+		
+		unsigned long executions = 0;
+		unsigned long faults = 0;
+		
+		for (uint32_t i = 0; i < code.size(); i++)
+		{
+			executions += job.pc_executions[i];
+			faults += job.pc_faults[i];
+		}
+		
+		listing << std::dec << "Job " << job.id << ": " << executions << " instructions retired, " << faults << " page faults" << std::endl
+				<< "      pc  word      executions  faults       %  instruction" << std::endl;
+		
+		uint32_t block = 0;
+		
+		for (uint32_t i = 0; i < code.size(); i++)
+		{
+			uint32_t address = i * sizeof(types::Word);
+			
+			if (leaders.count(i) != 0)
+			{
+				block = address;
+				
+				// a block is entered as often as its first instruction runs
+				unsigned long block_executions = 0;
+				unsigned long block_faults = 0;
+				
+				for (uint32_t k = i; k < code.size() && (k == i || leaders.count(k) == 0); k++)
+				{
+					block_executions += job.pc_executions[k];
+					block_faults += job.pc_faults[k];
+				}
+				
+				listing << std::dec << "block 0x" << std::hex << address << std::dec << ": entered " << job.pc_executions[i] << " times, "
+						<< block_executions << " instructions, " << block_faults << " page faults" << std::endl;
+			}
+			
+			listing << "  0x" << std::hex << std::setw(4) << std::setfill('0') << address << "  " << std::setw(8) << code[i] << std::setfill(' ') << std::dec
+					<< std::setw(12) << job.pc_executions[i] << std::setw(8) << job.pc_faults[i]
+					<< std::setw(7) << std::fixed << std::setprecision(1) << (executions > 0 ? 100.0 * job.pc_executions[i] / executions : 0) << "%  "
+					<< isa::Disassemble(code[i]) << std::endl;
+			
+			if (job.pc_executions[i] > 0)
+			{
+				folded << std::dec << "job " << job.id << ";block 0x" << std::hex << block << ";0x" << address << " " << isa::Disassemble(code[i])
+					   << " " << std::dec << job.pc_executions[i] << std::endl;
+			}
+		}
+		
+		listing << std::endl;
+	}
+	
+	return true;
+}
+
+bool Read(std::string path, std::vector<PCB>& jobs)
+{
+	std::ifstream folded(path);
+	
+	if (!folded.is_open())
+	{
+		std::cout << "Cannot read guest profile " << path << std::endl;
+		return false;
+	}
+	
+	Enable(jobs);
+	
+	// job <id>;block 0x<address>;0x<address> <instruction> <count>
+	std::string line;
+	unsigned int line_num = 0;
+	bool valid = true;
+	
+	while (std::getline(folded, line))
+	{
+		line_num++;
+		
+		size_t second = line.find(';', line.find(';') + 1);
+		size_t last = line.rfind(' ');
+		
+		if (line.compare(0, 4, "job ") != 0 || second == std::string::npos || last == std::string::npos)
+		{
+			continue;
+		}
+		
+		unsigned int id;
+		uint32_t index;
+		unsigned long count;
+		
+		try
+		{
+			id = std::stoul(line.substr(4));
+			index = std::stoul(line.substr(second + 1), NULL, 16) / sizeof(types::Word);
+			count = std::stoul(line.substr(last + 1));
+		}
+		catch (const std::invalid_argument&)
+		{
+			std::cout << path << ":" << line_num << ": not a job, address or count" << std::endl;
+			valid = false;
+			continue;
+		}
+		catch (const std::out_of_range&)
+		{
+			std::cout << path << ":" << line_num << ": job, address or count out of range" << std::endl;
+			valid = false;
+			continue;
+		}
+		
+		for (int i = 0; i < jobs.size(); i++)
+		{
+			if (jobs[i].id == id && index < jobs[i].pc_executions.size())
+			{
+				jobs[i].pc_executions[index] = count;
+			}
+		}
+	}
+	
+	return valid;
+}
+
+}
@@ -0,0 +1,27 @@
+#ifndef GUEST_PROFILER_H
+#define GUEST_PROFILER_H
+
+#include <string>
+#include <vector>
+#include "disk.h"
+#include "pcb.h"
+
+// counts executions and page faults per guest instruction of every job. the CPUs only count
+// for processes that have counters, so the interpreter pays nothing while profiling is off
+namespace guest_profiler
+{
+// gives every job a counter per code word
+void Enable(std::vector<PCB>& jobs);
+
+// writes each job's code as annotated disassembly, split into basic blocks, to path and the
+// same counts as folded stacks (job;block;instruction count) to path.folded for flame graphs.
+// returns false if a file could not be written
+bool Write(Disk& disk, std::vector<PCB>& jobs, std::string path);
+
+// reads the execution counts back from a path.folded file written by Write. jobs sharing an
+// id get the same counts. returns false if the file could not be read or a line did not parse,
+// the lines that did are still read
+bool Read(std::string path, std::vector<PCB>& jobs);
+}
+
+#endif // GUEST_PROFILER_H
@@ -0,0 +1,261 @@
+#include "host_counters.h"
+#include <chrono>
+#include <iostream>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace host_counters
+{
+	static const char* PHASE_NAMES[NUM_PHASES] = {"none", "load", "schedule", "execute", "page-in", "report"};
+	
+	static bool enabled = false;
+	static PHASES current = NONE;
+	
+	static int fds[NUM_COUNTERS]; // -1 for counters that could not be opened
+	static int slots[NUM_COUNTERS]; // position in the group read
+	static int leader = -1;
+	static int num_open = 0;
+	
+	static uint64_t last_values[NUM_COUNTERS];
+	static std::chrono::steady_clock::time_point last_time;
+	
+	static uint64_t totals[NUM_PHASES][NUM_COUNTERS];
+	static double seconds[NUM_PHASES];
+	static unsigned long guest_instructions = 0;
+
+#if defined(__linux__)
+static int OpenCounter(uint32_t type, uint64_t config, int group_fd)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = group_fd == -1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	
+	return syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0); // this thread, any host CPU
+}
+#endif
+
+// current counter values, 0 for those not open
+static void ReadCounters(uint64_t* values)
+{
+	memset(values, 0, sizeof(uint64_t) * NUM_COUNTERS);
+
+#if defined(__linux__)
+	if (leader == -1)
+	{
+		return;
+	}
+	
+	uint64_t buffer[1 + NUM_COUNTERS]; // count, then one value per open counter
+	
+	if (read(leader, buffer, sizeof(buffer)) <= 0)
+	{
+		return;
+	}
+	
+	for (int i = 0; i < NUM_COUNTERS; i++)
+	{
+		if (fds[i] != -1 && slots[i] < buffer[0])
+		{
+			values[i] = buffer[1 + slots[i]];
+		}
+	}
+#endif
+}
+
+bool Open()
+{
+	enabled = true;
+	current = NONE;
+	
+	for (int i = 0; i < NUM_COUNTERS; i++)
+	{
+		fds[i] = -1;
+	}
+
+#if defined(__linux__)
+	const uint32_t types[NUM_COUNTERS] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+	const uint64_t configs[NUM_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+	int error = 0;
+	
+	// the first counter that opens leads the group, so they are all read in one go
+	for (int i = 0; i < NUM_COUNTERS; i++)
+	{
+		fds[i] = OpenCounter(types[i], configs[i], leader);
+		
+		if (fds[i] == -1)
+		{
+			error = errno;
+			continue;
+		}
+		
+		if (leader == -1)
+		{
+			leader = fds[i];
+		}
+		
+		slots[i] = num_open++;
+	}
+	
+	if (leader != -1)
+	{
+		ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+	else
+	{
+		std::cout << "Host counters not available (" << strerror(error) << "), phases are only timed" << std::endl;
+	}
+#else
+	std::cout << "Host counters not available on this platform, phases are only timed" << std::endl;
+#endif
+
+	ReadCounters(last_values);
+	last_time = std::chrono::steady_clock::now();
+	
+	return leader != -1;
+}
+
+PHASES Enter(PHASES phase)
+{
+	PHASES previous = current;
+	
+	if (!enabled || phase == current)
+	{
+		return previous;
+	}
+	
+	uint64_t values[NUM_COUNTERS];
+	ReadCounters(values);
+	std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+	
+	for (int i = 0; i < NUM_COUNTERS; i++)
+	{
+		totals[current][i] += values[i] - last_values[i];
+		last_values[i] = values[i];
+	}
+	
+	seconds[current] += std::chrono::duration<double>(time - last_time).count();
+	last_time = time;
+	
+	current = phase;
+	
+	return previous;
+}
+
+void AddGuestInstructions(unsigned long count)
+{
+	guest_instructions += count;
+}
+
+void Close()
+{
+	Enter(NONE);
+
+#if defined(__linux__)
+	for (int i = 0; i < NUM_COUNTERS; i++)
+	{
+		if (fds[i] != -1)
+		{
+			close(fds[i]);
+			fds[i] = -1;
+		}
+	}
+	
+	leader = -1;
+	num_open = 0;
+#endif
+
+	enabled = false;
+}
+
+// a counter's value, or "-" if it was not counted
+static void PrintCounter(COUNTERS counter, uint64_t value)
+{
+	if (fds[counter] == -1)
+	{
+		std::cout << ", -";
+	}
+	else
+	{
+		std::cout << ", " << value;
+	}
+}
+
+void PrintStatistics()
+{
+	bool counted = leader != -1;
+	
+	std::cout << std::endl << "Host time and counters per phase:" << std::endl
+			  << "phase, ms, cycles, instructions, IPC, branch misses, cache misses, dTLB misses, branch misses per 1000 instructions" << std::endl;
+	
+	for (int phase = LOAD; phase < NUM_PHASES; phase++)
+	{
+		uint64_t* values = totals[phase];
+		
+		std::cout << std::dec << PHASE_NAMES[phase] << ", " << seconds[phase] * 1000;
+		
+		if (!counted)
+		{
+			std::cout << std::endl;
+			continue;
+		}
+		
+		PrintCounter(CYCLES, values[CYCLES]);
+		PrintCounter(INSTRUCTIONS, values[INSTRUCTIONS]);
+		
+		if (fds[CYCLES] != -1 && fds[INSTRUCTIONS] != -1 && values[CYCLES] > 0)
+		{
+			std::cout << ", " << values[INSTRUCTIONS] / (double)values[CYCLES];
+		}
+		else
+		{
+			std::cout << ", -";
+		}
+		
+		PrintCounter(BRANCH_MISSES, values[BRANCH_MISSES]);
+		PrintCounter(CACHE_MISSES, values[CACHE_MISSES]);
+		PrintCounter(DTLB_MISSES, values[DTLB_MISSES]);
+		
+		if (fds[BRANCH_MISSES] != -1 && fds[INSTRUCTIONS] != -1 && values[INSTRUCTIONS] > 0)
+		{
+			std::cout << ", " << 1000.0 * values[BRANCH_MISSES] / values[INSTRUCTIONS];
+		}
+		else
+		{
+			std::cout << ", -";
+		}
+		
+		std::cout << std::endl;
+	}
+	
+	std::cout << "Guest instructions: " << guest_instructions;
+	
+	if (seconds[EXECUTE] > 0)
+	{
+		std::cout << ", " << guest_instructions / seconds[EXECUTE] / 1e6 << " million per second of execute phase";
+	}
+	
+	if (counted && fds[INSTRUCTIONS] != -1 && guest_instructions > 0)
+	{
+		std::cout << ", " << totals[EXECUTE][INSTRUCTIONS] / (double)guest_instructions << " host instructions each";
+	}
+	
+	std::cout << std::endl;
+}
+
+}
@@ -0,0 +1,25 @@
+#ifndef HOST_COUNTERS_H
+#define HOST_COUNTERS_H
+
+// host hardware counters (Linux perf events) charged to the phase of the run the host is in.
+// only the main thread is counted. when counters are not permitted the phases are still timed
+namespace host_counters
+{
+enum PHASES {NONE, LOAD, SCHEDULE, EXECUTE, PAGE_IN, REPORT, NUM_PHASES}; // NONE is not reported
+
+enum COUNTERS {CYCLES, INSTRUCTIONS, BRANCH_MISSES, CACHE_MISSES, DTLB_MISSES, NUM_COUNTERS};
+
+// opens the counters and starts charging to NONE. returns false if none could be opened
+bool Open();
+
+// charges everything since the last switch to the current phase and moves on to the given one.
+// returns the phase that was left, so nested phases can switch back to it
+PHASES Enter(PHASES phase);
+
+void AddGuestInstructions(unsigned long count); // retired by the guest in the EXECUTE phase
+
+void Close();
+void PrintStatistics();
+}
+
+#endif // HOST_COUNTERS_H
@@ -0,0 +1,239 @@
+#include "io_channels.h"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdlib.h>
+
+IoChannels::IoChannels(Disk& disk, MemManager& mmu) : disk_(disk), mmu_(mmu)
+{
+}
+
+IoChannels::Record IoChannels::ReadRecord(Channel& channel, unsigned int capacity)
+{
+	Record record;
+	std::string text;
+	
+	while (std::getline(channel.input, text))
+	{
+		channel.line++;
+		
+		std::istringstream fields(text);
+		std::string field;
+		
+		while (fields >> field)
+		{
+			// the rest of the line is a comment
+			if (field.compare(0, 2, "//") == 0)
+			{
+				break;
+			}
+			
+			char* end;
+			unsigned long word = strtoul(field.c_str(), &end, 0);
+			
+			if (*end != '\0' || word > 0xFFFFFFFF)
+			{
+				record.error = channel.input_path + ":" + std::to_string(channel.line) + ": " + field + " is not a word";
+				record.words.clear();
+				return record;
+			}
+			
+			record.words.push_back(word);
+		}
+		
+		if (record.words.size() > capacity)
+		{
+			record.error = channel.input_path + ":" + std::to_string(channel.line) + ": record has " + std::to_string(record.words.size())
+						   + " words, the input buffer holds " + std::to_string(capacity);
+			record.words.clear();
+			return record;
+		}
+		
+		// blank and comment lines hold no record
+		if (!record.words.empty())
+		{
+			return record;
+		}
+	}
+	
+	return record;
+}
+
+void IoChannels::ReadAhead(PCB* job, Channel& channel)
+{
+	unsigned int capacity = (job->output_buffer_offset - job->input_buffer_offset) / sizeof(types::Word);
+	channel.next = std::async(std::launch::async, ReadRecord, std::ref(channel), capacity);
+}
+
+void IoChannels::Store(PCB* job, uint32_t offset, types::Word word)
+{
+	disk_.Write(job->disk_address + offset, &word, sizeof(word));
+	
+	// resident pages are written in place, like a DMA transfer, so the next run does not fault them in again
+	uint32_t frame = job->page_table[Machine::PageOf(offset)];
+	
+	if (frame != 0xFFFFFFFF)
+	{
+		uint32_t absolute_address = mmu_.GetFrameAddress(frame) | Machine::OffsetOf(offset);
+		mmu_.StoreWord(absolute_address, word);
+		
+		CacheHierarchy* caches = mmu_.GetCacheHierarchy();
+		
+		if (caches != NULL)
+		{
+			caches->InvalidateRange(absolute_address, sizeof(types::Word));
+		}
+	}
+}
+
+void IoChannels::Fill(PCB* job, const std::vector<types::Word>& words)
+{
+	for (uint32_t offset = job->input_buffer_offset; offset < job->output_buffer_offset; offset += sizeof(types::Word))
+	{
+		unsigned int i = (offset - job->input_buffer_offset) / sizeof(types::Word);
+		Store(job, offset, i < words.size() ? words[i] : 0);
+	}
+}
+
+void IoChannels::Reset(PCB* job, Channel& channel)
+{
+	for (unsigned int i = 0; i < channel.buffers.size(); i++)
+	{
+		Store(job, job->output_buffer_offset + i * sizeof(types::Word), channel.buffers[i]);
+	}
+}
+
+bool IoChannels::Attach(PCB& job, std::string input_path, std::string output_path)
+{
+	Channel& channel = channels_[&job];
+	channel.line = 0;
+	channel.records_in = 0;
+	channel.records_out = 0;
+	
+	for (uint32_t offset = job.output_buffer_offset; offset < job.program_size; offset += sizeof(types::Word))
+	{
+		types::Word word;
+		disk_.Read(job.disk_address + offset, &word, sizeof(word));
+		channel.buffers.push_back(word);
+	}
+	
+	if (output_path != "")
+	{
+		channel.output_path = output_path;
+		channel.output.open(output_path);
+		
+		if (!channel.output.is_open())
+		{
+			std::cout << "Cannot write " << output_path << std::endl;
+			return false;
+		}
+	}
+	
+	if (input_path == "")
+	{
+		return true;
+	}
+	
+	channel.input_path = input_path;
+	channel.input.open(input_path);
+	
+	if (!channel.input.is_open())
+	{
+		std::cout << "Cannot open " << input_path << std::endl;
+		return false;
+	}
+	
+	ReadAhead(&job, channel);
+	
+	Record record = channel.next.get();
+	
+	if (record.words.empty())
+	{
+		std::cout << (record.error != "" ? record.error : input_path + " holds no records") << std::endl;
+		return false;
+	}
+	
+	Fill(&job, record.words);
+	channel.records_in++;
+	
+	ReadAhead(&job, channel);
+	return true;
+}
+
+bool IoChannels::HandOff(PCB* job)
+{
+	std::map<PCB*, Channel>::iterator it = channels_.find(job);
+	
+	if (it == channels_.end())
+	{
+		return false;
+	}
+	
+	Channel& channel = it->second;
+	
+	if (channel.output.is_open())
+	{
+		for (uint32_t offset = job->output_buffer_offset; offset < job->temp_buffer_offset; offset += sizeof(types::Word))
+		{
+			types::Word word;
+			disk_.Read(job->disk_address + offset, &word, sizeof(word));
+			
+			channel.output << (offset > job->output_buffer_offset ? " " : "") << "0x" << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << word;
+		}
+		
+		channel.output << std::endl;
+		channel.records_out++;
+	}
+	
+	if (!channel.next.valid())
+	{
+		return false;
+	}
+	
+	Record record = channel.next.get();
+	
+	if (record.error != "")
+	{
+		std::cout << record.error << std::endl;
+	}
+	
+	if (record.words.empty())
+	{
+		return false;
+	}
+	
+	Fill(job, record.words);
+	Reset(job, channel);
+	channel.records_in++;
+	
+	ReadAhead(job, channel);
+	return true;
+}
+
+void IoChannels::PrintStatistics()
+{
+	if (channels_.empty())
+	{
+		return;
+	}
+	
+	std::cout << std::dec << "I/O channels:" << std::endl;
+	
+	for (std::map<PCB*, Channel>::iterator it = channels_.begin(); it != channels_.end(); it++)
+	{
+		Channel& channel = it->second;
+		std::cout << "Job " << it->first->id << ": ";
+		
+		if (channel.input_path != "")
+		{
+			std::cout << channel.records_in << " records from " << channel.input_path;
+		}
+		
+		if (channel.output_path != "")
+		{
+			std::cout << (channel.input_path != "" ? ", " : "") << channel.records_out << " to " << channel.output_path;
+		}
+		
+		std::cout << std::endl;
+	}
+}
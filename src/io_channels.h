@@ -0,0 +1,79 @@
+#ifndef IO_CHANNELS_H
+#define IO_CHANNELS_H
+
+#include <fstream>
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+#include "disk.h"
+#include "memory_manager.h"
+#include "pcb.h"
+#include "types.h"
+
+// I/O channels between jobs and host files. an input file is a stream of records, one per
+// line of words (hex with 0x or decimal). each record is handed into the job's input buffer
+// and the job is run over it, and when the job halts its output buffer is appended to the
+// output file as a line and the job runs again from the start on the next record, keeping its
+// frames. its output and temp buffers are put back as the deck had them and its registers
+// cleared, so each record runs on a fresh job. the channel reads the next record ahead on another thread while the job runs on the
+// current one, and hands it straight into the job's resident frames as well as its disk image
+class IoChannels
+{
+private:
+	struct Record
+	{
+		std::vector<types::Word> words; // empty at the end of the stream
+		std::string error; // set for a record that did not parse, it ends the stream
+	};
+	
+	struct Channel
+	{
+		std::string input_path;
+		std::ifstream input;
+		unsigned int line; // of the input file, the last one read
+		std::future<Record> next; // read ahead, not valid once the stream has ended
+		
+		std::string output_path;
+		std::ofstream output;
+		
+		std::vector<types::Word> buffers; // the output and temp buffers as the deck had them
+		
+		unsigned long records_in;
+		unsigned long records_out;
+	};
+	
+	Disk& disk_;
+	MemManager& mmu_;
+	std::map<PCB*, Channel> channels_;
+	
+	// the next record of the input, at most capacity words
+	static Record ReadRecord(Channel& channel, unsigned int capacity);
+	
+	// starts reading the record after the one being handed in
+	void ReadAhead(PCB* job, Channel& channel);
+	
+	// writes a word of the job's image to disk and to its frame if the page is resident
+	void Store(PCB* job, uint32_t offset, types::Word word);
+	
+	// writes the record into the job's input buffer, padded with zeros
+	void Fill(PCB* job, const std::vector<types::Word>& words);
+	
+	// puts the job's output and temp buffers back as the deck had them
+	void Reset(PCB* job, Channel& channel);
+
+public:
+	IoChannels(Disk& disk, MemManager& mmu);
+	
+	// connects a job to host files, either path may be "". the first record goes into the job's
+	// disk image straight away. returns false if a file cannot be opened or the input is empty
+	bool Attach(PCB& job, std::string input_path, std::string output_path);
+	
+	// call when the job has halted and its image is back on disk. writes its output out and hands
+	// the next record in with the buffers reset. returns true if the job has another record to run on
+	bool HandOff(PCB* job);
+	
+	void PrintStatistics();
+};
+
+#endif // IO_CHANNELS_H
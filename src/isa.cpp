@@ -0,0 +1,299 @@
+#include "isa.h"
+#include <cctype>
+#include <sstream>
+#include <vector>
+
+namespace isa
+{
+
+std::string Disassemble(types::Word word)
+{
+	const Instruction instruction = Decode(word);
+	const OpcodeInfo& info = OPCODE_TABLE[instruction.opcode];
+	
+	std::ostringstream text;
+	
+	if (info.name == NULL)
+	{
+		text << ".word 0x" << std::hex << word;
+		return text.str();
+	}
+	
+	text << info.name;
+	
+	if (instruction.opcode == HLT || instruction.opcode == NOP)
+	{
+		return text.str();
+	}
+	
+	// operands in encoding order
+	switch (instruction.format)
+	{
+		case ARITHMETIC:
+		{
+			text << " r" << (int)instruction.reg1 << ", r" << (int)instruction.reg2 << ", r" << (int)instruction.reg3;
+			break;
+		}
+		
+		case UNCONDITIONAL_JUMP:
+		{
+			text << " 0x" << std::hex << instruction.address;
+			break;
+		}
+		
+		default: // conditional/immediate and I/O
+		{
+			text << " r" << (int)instruction.reg1 << ", r" << (int)instruction.reg2 << ", 0x" << std::hex << instruction.address;
+			break;
+		}
+	}
+	
+	return text.str();
+}
+
+// a register as rN
+static bool ParseRegister(const std::string& text, uint32_t& reg)
+{
+	if (text.size() < 2 || (text[0] != 'r' && text[0] != 'R'))
+	{
+		return false;
+	}
+	
+	size_t end;
+	
+	try
+	{
+		reg = std::stoul(text.substr(1), &end, 10);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	
+	return end == text.size() - 1 && reg <= 0xF;
+}
+
+// an immediate in hex with 0x or in decimal
+static bool ParseImmediate(const std::string& text, uint32_t& value)
+{
+	size_t end;
+	
+	try
+	{
+		value = std::stoul(text, &end, 0);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	
+	return end == text.size() && value <= 0xFFFF;
+}
+
+bool Assemble(const std::string& text, types::Word& instruction)
+{
+	// mnemonic and operands, split at spaces and commas, up to a // comment
+	std::vector<std::string> tokens;
+	std::string token;
+	std::string line = text.substr(0, text.find("//"));
+	
+	for (size_t i = 0; i <= line.size(); i++)
+	{
+		if (i == line.size() || isspace((unsigned char)line[i]) || line[i] == ',')
+		{
+			if (token != "")
+			{
+				tokens.push_back(token);
+			}
+			
+			token = "";
+		}
+		else
+		{
+			token += toupper((unsigned char)line[i]);
+		}
+	}
+	
+	if (tokens.empty())
+	{
+		return false;
+	}
+	
+	unsigned int opcode = 0;
+	
+	while (opcode < NUM_OPCODES && (OPCODE_TABLE[opcode].name == NULL || tokens[0] != OPCODE_TABLE[opcode].name))
+	{
+		opcode++;
+	}
+	
+	if (opcode == NUM_OPCODES)
+	{
+		return false;
+	}
+	
+	const OpcodeInfo& info = OPCODE_TABLE[opcode];
+	uint32_t fields[3] = {0, 0, 0};
+	
+	instruction = (uint32_t)info.format << FORMAT.shift | opcode << OPCODE.shift;
+	
+	if (opcode == HLT || opcode == NOP)
+	{
+		return tokens.size() == 1;
+	}
+	
+	switch (info.format)
+	{
+		case ARITHMETIC:
+		{
+			if (tokens.size() != 4 || !ParseRegister(tokens[1], fields[0]) || !ParseRegister(tokens[2], fields[1]) || !ParseRegister(tokens[3], fields[2]))
+			{
+				return false;
+			}
+			
+			instruction |= fields[0] << REG1.shift | fields[1] << REG2.shift | fields[2] << REG3.shift;
+			return true;
+		}
+		
+		case UNCONDITIONAL_JUMP:
+		{
+			if (tokens.size() != 2 || !ParseImmediate(tokens[1], fields[0]))
+			{
+				return false;
+			}
+			
+			instruction |= fields[0] << ADDRESS.shift;
+			return true;
+		}
+		
+		default: // conditional/immediate and I/O
+		{
+			if (tokens.size() != 4 || !ParseRegister(tokens[1], fields[0]) || !ParseRegister(tokens[2], fields[1]) || !ParseImmediate(tokens[3], fields[2]))
+			{
+				return false;
+			}
+			
+			instruction |= fields[0] << REG1.shift | fields[1] << REG2.shift | fields[2] << ADDRESS.shift;
+			return true;
+		}
+	}
+}
+
+Operands RegisterOperands(const Instruction& instruction)
+{
+	Operands operands = {{-1, -1}, -1};
+	
+	switch (instruction.opcode)
+	{
+		case RD: // the address comes from reg2 when it is not 0
+		{
+			if (instruction.reg2 > 0)
+			{
+				operands.sources[0] = instruction.reg2;
+			}
+			
+			operands.destination = instruction.reg1;
+			break;
+		}
+		
+		case WR: // the address comes from reg2 when the immediate is 0
+		{
+			operands.sources[0] = instruction.reg1;
+			
+			if (instruction.address == 0)
+			{
+				operands.sources[1] = instruction.reg2;
+			}
+			
+			break;
+		}
+		
+		case ST:
+		case BEQ:
+		case BNE:
+		{
+			operands.sources[0] = instruction.reg1;
+			operands.sources[1] = instruction.reg2;
+			break;
+		}
+		
+		case LW:
+		case SLTI:
+		{
+			operands.sources[0] = instruction.reg1;
+			operands.destination = instruction.reg2;
+			break;
+		}
+		
+		case MOV:
+		{
+			operands.sources[0] = instruction.reg2;
+			operands.destination = instruction.reg1;
+			break;
+		}
+		
+		case ADD:
+		case SUB:
+		case MUL:
+		case DIV:
+		case AND:
+		case OR:
+		case SLT:
+		{
+			operands.sources[0] = instruction.reg1;
+			operands.sources[1] = instruction.reg2;
+			operands.destination = instruction.reg3;
+			break;
+		}
+		
+		case MOVI:
+		case LDI:
+		case LUI:
+		{
+			operands.destination = instruction.reg2;
+			break;
+		}
+		
+		case ADDI:
+		case MULI:
+		case DIVI:
+		{
+			operands.sources[0] = instruction.reg2;
+			operands.destination = instruction.reg2;
+			break;
+		}
+		
+		case BEZ:
+		case BNZ:
+		case BGZ:
+		case BLZ:
+		{
+			operands.sources[0] = instruction.reg1;
+			break;
+		}
+		
+		// the count in reg3 and the addresses are moved on as well, only the one in reg2 is tracked
+		case BCPY:
+		case BFIL:
+		case VADD:
+		case VSUM:
+		case VMIN:
+		case VMAX:
+		{
+			operands.sources[0] = instruction.reg1;
+			operands.sources[1] = instruction.reg3;
+			operands.destination = instruction.reg2;
+			break;
+		}
+		
+		case CSWP:
+		{
+			operands.sources[0] = instruction.reg1;
+			operands.destination = instruction.reg2;
+			break;
+		}
+	}
+	
+	return operands;
+}
+
+}
@@ -0,0 +1,152 @@
+#ifndef ISA_H
+#define ISA_H
+
+#include <array>
+#include <string>
+#include <stdint.h>
+#include "types.h"
+#include "machine_config.h"
+
+// instruction set: encodings, decode fields and per-opcode properties
+namespace isa
+{
+
+enum OPCODES
+{
+	RD = 0x0, WR, ST, LW, MOV, ADD, SUB, MUL, DIV, AND, OR, MOVI, ADDI, MULI, DIVI, LDI,
+	SLT, SLTI, HLT, NOP, JMP, BEQ, BNE, BEZ, BNZ, BGZ, BLZ, LUI,
+	
+	// block and vector instructions over reg3 words. reg1 is the source address, reg2 the destination
+	// address or the register reduced into. they move their registers on as they go, so one that
+	// faults part way resumes where it stopped
+	BCPY, BFIL, VADD, VSUM, VMIN, VMAX,
+	
+	CSWP // swaps the words at the address if they are out of order, for sorting
+};
+
+const unsigned int NUM_OPCODES = 0x40; // 6 bit opcode field
+
+// front 2 bits
+enum FORMATS {ARITHMETIC, CONDITIONAL_IMMEDIATE, UNCONDITIONAL_JUMP, IO};
+
+// a bit field of an instruction word
+struct Field
+{
+	unsigned int shift;
+	uint32_t mask;
+	
+	constexpr uint32_t operator()(types::Word instruction) const
+	{
+		return (instruction >> shift) & mask;
+	}
+};
+
+constexpr Field FORMAT = {30, 0x3};
+constexpr Field OPCODE = {24, 0x3F};
+constexpr Field REG1 = {20, 0xF & Machine::REGISTER_MASK}; // s-reg 1 / b-reg
+constexpr Field REG2 = {16, 0xF & Machine::REGISTER_MASK}; // s-reg 2 / d-reg
+constexpr Field REG3 = {12, 0xF & Machine::REGISTER_MASK}; // d-reg of arithmetic instructions
+constexpr Field ADDRESS = {0, 0xFFFF}; // address or immediate data
+
+// every field of an instruction word, decoded once
+struct Instruction
+{
+	uint8_t format;
+	uint8_t opcode;
+	uint8_t reg1;
+	uint8_t reg2;
+	uint8_t reg3;
+	uint16_t address;
+};
+
+constexpr Instruction Decode(types::Word instruction)
+{
+	return Instruction{(uint8_t)FORMAT(instruction), (uint8_t)OPCODE(instruction),
+					   (uint8_t)REG1(instruction), (uint8_t)REG2(instruction), (uint8_t)REG3(instruction),
+					   (uint16_t)ADDRESS(instruction)};
+}
+
+// what an opcode does, for tools that look at code without running it
+struct OpcodeInfo
+{
+	const char* name; // NULL for unused opcodes
+	bool branch; // may change the program counter
+	bool conditional;
+	bool reads_memory;
+	bool writes_memory;
+	bool ends_program;
+	uint8_t format; // FORMATS, for the assembler
+	bool block; // runs over a range of words
+	uint8_t frames; // pages it may need resident at once, its own included
+};
+
+constexpr std::array<OpcodeInfo, NUM_OPCODES> MakeOpcodeTable()
+{
+	std::array<OpcodeInfo, NUM_OPCODES> table = {};
+	
+	const char* names[] = {"RD", "WR", "ST", "LW", "MOV", "ADD", "SUB", "MUL", "DIV", "AND", "OR", "MOVI", "ADDI", "MULI", "DIVI", "LDI",
+						   "SLT", "SLTI", "HLT", "NOP", "JMP", "BEQ", "BNE", "BEZ", "BNZ", "BGZ", "BLZ", "LUI",
+						   "BCPY", "BFIL", "VADD", "VSUM", "VMIN", "VMAX", "CSWP"};
+	
+	for (unsigned int opcode = RD; opcode <= CSWP; opcode++)
+	{
+		table[opcode].name = names[opcode];
+		table[opcode].branch = opcode >= JMP && opcode <= BLZ;
+		table[opcode].conditional = opcode > JMP && opcode <= BLZ;
+		table[opcode].reads_memory = opcode == RD || opcode == LW || (opcode >= BCPY && opcode != BFIL);
+		table[opcode].writes_memory = opcode == WR || opcode == ST || opcode == BCPY || opcode == BFIL || opcode == VADD || opcode == CSWP;
+		table[opcode].ends_program = opcode == HLT;
+		table[opcode].block = opcode >= BCPY && opcode <= VMAX;
+		
+		// a source and a destination page, or a pair of words that may straddle two
+		if (opcode == BCPY || opcode == VADD || opcode == CSWP)
+		{
+			table[opcode].frames = 3;
+		}
+		else
+		{
+			table[opcode].frames = table[opcode].reads_memory || table[opcode].writes_memory ? 2 : 1;
+		}
+		
+		if (opcode == RD || opcode == WR)
+		{
+			table[opcode].format = IO;
+		}
+		else if ((opcode >= MOV && opcode <= OR) || opcode == SLT || table[opcode].block)
+		{
+			table[opcode].format = ARITHMETIC;
+		}
+		else if (opcode == HLT || opcode == NOP || opcode == JMP)
+		{
+			table[opcode].format = UNCONDITIONAL_JUMP;
+		}
+		else
+		{
+			table[opcode].format = CONDITIONAL_IMMEDIATE;
+		}
+	}
+	
+	return table;
+}
+
+constexpr std::array<OpcodeInfo, NUM_OPCODES> OPCODE_TABLE = MakeOpcodeTable();
+
+// registers an instruction reads and writes, -1 where there is none
+struct Operands
+{
+	int8_t sources[2];
+	int8_t destination;
+};
+
+Operands RegisterOperands(const Instruction& instruction);
+
+// one instruction as assembly text, operands in encoding order and immediates in hex
+std::string Disassemble(types::Word instruction);
+
+// the word for a line of assembly in the form Disassemble writes, immediates in hex or decimal.
+// returns false if it is not an instruction
+bool Assemble(const std::string& text, types::Word& instruction);
+
+}
+
+#endif // ISA_H
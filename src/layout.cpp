@@ -0,0 +1,672 @@
+#include "layout.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include "isa.h"
+#include "verifier.h"
+
+namespace layout
+{
+
+const types::Word NOP_WORD = (types::Word)isa::OPCODE_TABLE[isa::NOP].format << isa::FORMAT.shift | (types::Word)isa::NOP << isa::OPCODE.shift;
+
+// pages a run of words starting at a word index spans
+static unsigned int PagesSpanned(uint32_t first, uint32_t count)
+{
+	return count == 0 ? 0 : (first + count - 1) / Machine::FRAME_WORDS - first / Machine::FRAME_WORDS + 1;
+}
+
+// where a register's value came from. sites are the instructions whose immediate, a data
+// address, is part of it
+struct Value
+{
+	std::set<uint32_t> sites;
+	bool opaque; // loaded or computed, nothing is known about it
+};
+
+typedef std::array<Value, Machine::REGISTER_COUNT> State;
+
+static Value Opaque()
+{
+	Value value;
+	value.opaque = true;
+	return value;
+}
+
+// a constant that is not a data address
+static Value Known()
+{
+	Value value;
+	value.opaque = false;
+	return value;
+}
+
+// joins new_state into state. returns true if state changed
+static bool Join(State& state, const State& new_state)
+{
+	bool changed = false;
+	
+	for (int i = 0; i < Machine::REGISTER_COUNT; i++)
+	{
+		size_t num_sites = state[i].sites.size();
+		state[i].sites.insert(new_state[i].sites.begin(), new_state[i].sites.end());
+		
+		if (state[i].sites.size() != num_sites || (new_state[i].opaque && !state[i].opaque))
+		{
+			state[i].opaque = state[i].opaque || new_state[i].opaque;
+			changed = true;
+		}
+	}
+	
+	return changed;
+}
+
+// finds the immediates a job addresses its data with, so the data can be moved by patching
+// them. a data address has to reach every access as one immediate plus offsets, and must
+// not be used as a plain number
+class AddressAnalysis
+{
+private:
+	const std::vector<types::Word>& code_;
+	uint32_t data_start_;
+	uint32_t image_end_;
+	
+	std::set<uint32_t> addresses_; // sites accesses were made through
+	std::vector<std::set<uint32_t> > couples_; // sites compared or subtracted, they move together
+	std::set<uint32_t> numbers_; // sites whose values were stored or multiplied
+	std::string reason_;
+	
+	std::set<uint32_t> Immediate(unsigned int index, uint32_t value)
+	{
+		std::set<uint32_t> sites;
+		
+		if (value >= data_start_ && value <= image_end_)
+		{
+			sites.insert(index);
+		}
+		
+		return sites;
+	}
+	
+	void Fail(unsigned int index, const char* what)
+	{
+		if (reason_ == "")
+		{
+			std::ostringstream reason;
+			reason << what << " at 0x" << std::hex << index * sizeof(types::Word);
+			reason_ = reason.str();
+		}
+	}
+	
+	// an access at the base register, if any, plus the immediate
+	void Access(unsigned int index, const Value* base, uint32_t immediate)
+	{
+		std::set<uint32_t> sites = Immediate(index, immediate);
+		bool opaque = false;
+		
+		if (base != NULL)
+		{
+			if (!base->sites.empty() && !sites.empty())
+			{
+				Fail(index, "two data addresses added");
+				return;
+			}
+			
+			sites.insert(base->sites.begin(), base->sites.end());
+			opaque = base->opaque;
+		}
+		
+		if (sites.empty())
+		{
+			Fail(index, opaque ? "access through an address of unknown origin" : "access to the code");
+			return;
+		}
+		
+		addresses_.insert(sites.begin(), sites.end());
+	}
+	
+	void Couple(const Value& a, const Value& b)
+	{
+		std::set<uint32_t> sites = a.sites;
+		sites.insert(b.sites.begin(), b.sites.end());
+		couples_.push_back(sites);
+	}
+	
+	void Number(const Value& value)
+	{
+		numbers_.insert(value.sites.begin(), value.sites.end());
+	}
+	
+	void Step(unsigned int index, State& r)
+	{
+		const isa::Instruction instruction = isa::Decode(code_[index]);
+		Value immediate = Known();
+		immediate.sites = Immediate(index, instruction.address);
+		
+		switch (instruction.opcode)
+		{
+			case isa::RD:
+				Access(index, instruction.reg2 > 0 ? &r[instruction.reg2] : NULL, instruction.reg2 > 0 ? 0 : instruction.address);
+				r[instruction.reg1] = Opaque();
+				break;
+			
+			case isa::WR:
+				Number(r[instruction.reg1]);
+				Access(index, instruction.address == 0 ? &r[instruction.reg2] : NULL, instruction.address);
+				break;
+			
+			case isa::ST:
+				Number(r[instruction.reg1]);
+				Access(index, &r[instruction.reg2], instruction.address);
+				break;
+			
+			case isa::LW:
+				Access(index, &r[instruction.reg1], instruction.address);
+				r[instruction.reg2] = Opaque();
+				break;
+			
+			case isa::CSWP:
+				Number(r[instruction.reg2]);
+				Access(index, &r[instruction.reg1], instruction.address);
+				r[instruction.reg2] = Opaque();
+				break;
+			
+			case isa::MOV:
+				r[instruction.reg1] = r[instruction.reg2];
+				break;
+			
+			case isa::ADD:
+			{
+				if (!r[instruction.reg1].sites.empty() && !r[instruction.reg2].sites.empty())
+				{
+					Fail(index, "two data addresses added");
+				}
+				
+				Value sum = r[instruction.reg1];
+				sum.sites.insert(r[instruction.reg2].sites.begin(), r[instruction.reg2].sites.end());
+				sum.opaque = sum.opaque || r[instruction.reg2].opaque;
+				r[instruction.reg3] = sum;
+				break;
+			}
+			
+			// the distance between two addresses stays the same when both move
+			case isa::SUB:
+			{
+				Value difference = r[instruction.reg1];
+				difference.opaque = difference.opaque || r[instruction.reg2].opaque;
+				
+				if (!r[instruction.reg2].sites.empty())
+				{
+					Couple(r[instruction.reg1], r[instruction.reg2]);
+					difference = Opaque();
+				}
+				
+				r[instruction.reg3] = difference;
+				break;
+			}
+			
+			case isa::MUL:
+			case isa::DIV:
+			case isa::AND:
+			case isa::OR:
+				Number(r[instruction.reg1]);
+				Number(r[instruction.reg2]);
+				r[instruction.reg3] = Opaque();
+				break;
+			
+			case isa::MOVI:
+			case isa::LDI:
+				r[instruction.reg2] = immediate;
+				break;
+			
+			case isa::LUI:
+				r[instruction.reg2] = Known();
+				break;
+			
+			case isa::ADDI:
+				if (!r[instruction.reg2].sites.empty() && !immediate.sites.empty())
+				{
+					Fail(index, "two data addresses added");
+				}
+				
+				r[instruction.reg2].sites.insert(immediate.sites.begin(), immediate.sites.end());
+				break;
+			
+			case isa::MULI:
+			case isa::DIVI:
+				Number(r[instruction.reg2]);
+				r[instruction.reg2] = Opaque();
+				break;
+			
+			case isa::SLT:
+				Couple(r[instruction.reg1], r[instruction.reg2]);
+				r[instruction.reg3] = Opaque();
+				break;
+			
+			case isa::SLTI:
+				Couple(r[instruction.reg1], immediate);
+				r[instruction.reg2] = Opaque();
+				break;
+			
+			case isa::BEQ:
+			case isa::BNE:
+				Couple(r[instruction.reg1], r[instruction.reg2]);
+				break;
+			
+			default:
+				if (isa::OPCODE_TABLE[instruction.opcode].block)
+				{
+					Fail(index, "block instruction");
+				}
+				
+				break;
+		}
+		
+		r[1] = Known(); // the zero register
+	}
+
+public:
+	AddressAnalysis(const std::vector<types::Word>& code, uint32_t data_start, uint32_t image_end)
+		: code_(code), data_start_(data_start), image_end_(image_end)
+	{
+	}
+	
+	// the instructions whose immediate has to move with the data. returns false with a reason
+	// if the data cannot be moved
+	bool Run(std::set<uint32_t>& patched, std::string& reason)
+	{
+		std::vector<State> states(code_.size());
+		std::vector<bool> reached(code_.size(), false);
+		
+		// registers start out unknown except the zero register
+		states[0].fill(Opaque());
+		states[0][1] = Known();
+		reached[0] = true;
+		
+		std::vector<unsigned int> worklist;
+		worklist.push_back(0);
+		
+		while (!worklist.empty() && reason_ == "")
+		{
+			unsigned int index = worklist.back();
+			worklist.pop_back();
+			
+			State state = states[index];
+			Step(index, state);
+			
+			// the verifier has checked the targets and that execution stays in the code
+			const isa::Instruction instruction = isa::Decode(code_[index]);
+			const isa::OpcodeInfo& info = isa::OPCODE_TABLE[instruction.opcode];
+			std::vector<unsigned int> successors;
+			
+			if (info.branch)
+			{
+				successors.push_back(instruction.address / sizeof(types::Word));
+			}
+			
+			if (!info.ends_program && (!info.branch || info.conditional))
+			{
+				successors.push_back(index + 1);
+			}
+			
+			for (int i = 0; i < successors.size(); i++)
+			{
+				unsigned int next = successors[i];
+				
+				if (!reached[next])
+				{
+					reached[next] = true;
+					states[next] = state;
+					worklist.push_back(next);
+				}
+				else if (Join(states[next], state))
+				{
+					worklist.push_back(next);
+				}
+			}
+		}
+		
+		// sites compared with or subtracted from an address are addresses too
+		patched = addresses_;
+		bool changed = true;
+		
+		while (changed)
+		{
+			changed = false;
+			
+			for (int i = 0; i < couples_.size(); i++)
+			{
+				bool moves = false;
+				
+				for (std::set<uint32_t>::iterator it = couples_[i].begin(); it != couples_[i].end() && !moves; it++)
+				{
+					moves = patched.count(*it) != 0;
+				}
+				
+				for (std::set<uint32_t>::iterator it = couples_[i].begin(); it != couples_[i].end() && moves; it++)
+				{
+					changed = patched.insert(*it).second || changed;
+				}
+			}
+		}
+		
+		for (std::set<uint32_t>::iterator it = patched.begin(); it != patched.end(); it++)
+		{
+			if (numbers_.count(*it) != 0)
+			{
+				Fail(*it, "data address also used as a number");
+			}
+		}
+		
+		reason = reason_;
+		return reason_ == "";
+	}
+};
+
+// a job's image laid out again
+struct Image
+{
+	std::vector<types::Word> code;
+	std::vector<types::Word> data;
+	unsigned int hot_pages; // of its hot code and its data
+};
+
+static Image Read(Disk& disk, PCB& job)
+{
+	Image image;
+	image.code.resize(job.input_buffer_offset / sizeof(types::Word));
+	image.data.resize((job.program_size - job.input_buffer_offset) / sizeof(types::Word));
+	
+	for (uint32_t i = 0; i < image.code.size(); i++)
+	{
+		disk.Read(job.disk_address + i * sizeof(types::Word), &image.code[i], sizeof(types::Word));
+	}
+	
+	for (uint32_t i = 0; i < image.data.size(); i++)
+	{
+		disk.Read(job.disk_address + job.input_buffer_offset + i * sizeof(types::Word), &image.data[i], sizeof(types::Word));
+	}
+	
+	return image;
+}
+
+// code words run more often than the least run ones in the profile, otherwise those inside a
+// backward branch
+static std::vector<bool> HotCode(PCB& job, const std::vector<types::Word>& code)
+{
+	std::vector<bool> hot(code.size(), false);
+	unsigned long least = 0;
+	
+	for (uint32_t i = 0; i < job.pc_executions.size(); i++)
+	{
+		if (job.pc_executions[i] > 0 && (least == 0 || job.pc_executions[i] < least))
+		{
+			least = job.pc_executions[i];
+		}
+	}
+	
+	if (least > 0)
+	{
+		for (uint32_t i = 0; i < code.size() && i < job.pc_executions.size(); i++)
+		{
+			hot[i] = job.pc_executions[i] > least;
+		}
+		
+		return hot;
+	}
+	
+	for (uint32_t i = 0; i < code.size(); i++)
+	{
+		const isa::Instruction instruction = isa::Decode(code[i]);
+		uint32_t target = instruction.address / sizeof(types::Word);
+		
+		if (isa::OPCODE_TABLE[instruction.opcode].branch && target <= i)
+		{
+			for (uint32_t j = target; j <= i; j++)
+			{
+				hot[j] = true;
+			}
+		}
+	}
+	
+	return hot;
+}
+
+static unsigned int HotPages(const std::vector<bool>& hot, const std::vector<uint32_t>& position, uint32_t data_start, uint32_t data_words)
+{
+	std::set<uint32_t> pages;
+	
+	for (uint32_t i = 0; i < hot.size(); i++)
+	{
+		if (hot[i])
+		{
+			pages.insert(position[i] / Machine::FRAME_WORDS);
+		}
+	}
+	
+	for (uint32_t i = 0; i < data_words; i++)
+	{
+		pages.insert((data_start + i) / Machine::FRAME_WORDS);
+	}
+	
+	return pages.size();
+}
+
+// the job laid out again. returns false with a reason if it cannot be moved or gains nothing
+static bool LayOut(Disk& disk, PCB& job, Image& image, unsigned int& hot_pages_before, std::string& reason)
+{
+	verifier::Report report = verifier::Verify(disk, job);
+	
+	// the control flow has to be known. the addresses are traced below
+	if (!report.control_flow)
+	{
+		reason = report.reason;
+		return false;
+	}
+	
+	Image original = Read(disk, job);
+	std::vector<bool> hot = HotCode(job, original.code);
+	
+	std::vector<uint32_t> position(original.code.size());
+	
+	for (uint32_t i = 0; i < position.size(); i++)
+	{
+		position[i] = i;
+	}
+	
+	hot_pages_before = HotPages(hot, position, original.code.size(), original.data.size());
+	
+	// each run of hot code starts at the offset into its page that spans the fewest pages.
+	// branches into a run go past its padding, so the NOPs only run when it is entered from above
+	std::vector<uint32_t> padding(original.code.size(), 0);
+	uint32_t next = 0;
+	
+	for (uint32_t i = 0; i < original.code.size(); i++)
+	{
+		if (hot[i] && (i == 0 || !hot[i - 1]))
+		{
+			uint32_t length = 0;
+			
+			while (i + length < hot.size() && hot[i + length])
+			{
+				length++;
+			}
+			
+			for (uint32_t pad = 1; pad < Machine::FRAME_WORDS; pad++)
+			{
+				if (PagesSpanned(next + pad, length) < PagesSpanned(next + padding[i], length))
+				{
+					padding[i] = pad;
+				}
+			}
+		}
+		
+		next += padding[i];
+		position[i] = next++;
+	}
+	
+	// the code never runs off its end, so padding after it is not executed
+	uint32_t data_start = next;
+	
+	for (uint32_t pad = 1; pad < Machine::FRAME_WORDS; pad++)
+	{
+		if (PagesSpanned(next + pad, original.data.size()) < PagesSpanned(data_start, original.data.size()))
+		{
+			data_start = next + pad;
+		}
+	}
+	
+	image.hot_pages = HotPages(hot, position, data_start, original.data.size());
+	
+	if (image.hot_pages >= hot_pages_before)
+	{
+		reason = "already laid out";
+		return false;
+	}
+	
+	std::set<uint32_t> patched;
+	uint32_t shift = (data_start - original.code.size()) * sizeof(types::Word);
+	
+	AddressAnalysis analysis(original.code, job.input_buffer_offset, job.program_size);
+	
+	if (!analysis.Run(patched, reason))
+	{
+		return false;
+	}
+	
+	image.code.assign(data_start, NOP_WORD);
+	image.data = original.data;
+	
+	for (uint32_t i = 0; i < original.code.size(); i++)
+	{
+		types::Word word = original.code[i];
+		const isa::Instruction instruction = isa::Decode(word);
+		uint32_t address = instruction.address;
+		
+		if (isa::OPCODE_TABLE[instruction.opcode].branch)
+		{
+			address = position[address / sizeof(types::Word)] * sizeof(types::Word);
+		}
+		else if (patched.count(i) != 0)
+		{
+			address += shift;
+		}
+		
+		if (address > isa::ADDRESS.mask)
+		{
+			reason = "addresses past 16 bits";
+			return false;
+		}
+		
+		image.code[position[i]] = (word & ~isa::ADDRESS.mask) | address;
+	}
+	
+	return true;
+}
+
+static std::string Hex(uint32_t value, const char* format)
+{
+	char text[16];
+	snprintf(text, sizeof(text), format, value);
+	return text;
+}
+
+bool Write(Disk& disk, std::vector<PCB>& jobs, std::string path)
+{
+	std::ofstream out(path.c_str());
+	
+	if (!out.is_open())
+	{
+		std::cout << "Could not write " << path << std::endl;
+		return false;
+	}
+	
+	std::vector<Image> images(jobs.size());
+	std::vector<unsigned int> hot_pages(jobs.size(), 0);
+	std::vector<int> candidates;
+	uint32_t deck_size = 0;
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		std::string reason;
+		deck_size += jobs[i].program_size;
+		
+		if (LayOut(disk, jobs[i], images[i], hot_pages[i], reason))
+		{
+			candidates.push_back(i);
+		}
+		else
+		{
+			std::cout << "Job " << jobs[i].id << " kept as written: " << reason << std::endl;
+			images[i] = Read(disk, jobs[i]);
+		}
+	}
+	
+	// the padding has to fit on the disk. the jobs that save the most pages for the words they
+	// add go first
+	std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b)
+	{
+		unsigned long saved_a = hot_pages[a] - images[a].hot_pages;
+		unsigned long saved_b = hot_pages[b] - images[b].hot_pages;
+		unsigned long added_a = images[a].code.size() + images[a].data.size() - jobs[a].program_size / sizeof(types::Word);
+		unsigned long added_b = images[b].code.size() + images[b].data.size() - jobs[b].program_size / sizeof(types::Word);
+		
+		return saved_a * added_b > saved_b * added_a;
+	});
+	
+	int num_laid_out = 0;
+	unsigned int pages_before = 0;
+	unsigned int pages_after = 0;
+	
+	for (int i = 0; i < candidates.size(); i++)
+	{
+		int j = candidates[i];
+		uint32_t added = (images[j].code.size() + images[j].data.size()) * sizeof(types::Word) - jobs[j].program_size;
+		
+		if (deck_size + added > Machine::DISK_SIZE)
+		{
+			std::cout << "Job " << jobs[j].id << " kept as written: no room on the disk" << std::endl;
+			images[j] = Read(disk, jobs[j]);
+			continue;
+		}
+		
+		deck_size += added;
+		num_laid_out++;
+		pages_before += hot_pages[j];
+		pages_after += images[j].hot_pages;
+	}
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		PCB& job = jobs[i];
+		Image& image = images[i];
+		
+		out << "// JOB " << Hex(job.id, "%X") << " " << Hex(image.code.size(), "%X") << " " << Hex(job.priority, "%X") << std::endl;
+		
+		for (int j = 0; j < image.code.size(); j++)
+		{
+			out << Hex(image.code[j], "0x%08X") << std::endl;
+		}
+		
+		out << "// Data " << Hex((job.output_buffer_offset - job.input_buffer_offset) / sizeof(types::Word), "%X")
+			<< " " << Hex((job.temp_buffer_offset - job.output_buffer_offset) / sizeof(types::Word), "%X")
+			<< " " << Hex((job.program_size - job.temp_buffer_offset) / sizeof(types::Word), "%X") << std::endl;
+		
+		for (int j = 0; j < image.data.size(); j++)
+		{
+			out << Hex(image.data[j], "0x%08X") << std::endl;
+		}
+		
+		out << "// END" << std::endl;
+	}
+	
+	std::cout << "Laid out " << num_laid_out << " of " << jobs.size() << " jobs, their hot pages " << pages_before << " -> " << pages_after << ", written to " << path << std::endl;
+	
+	return out.good();
+}
+
+}
@@ -0,0 +1,22 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <string>
+#include <vector>
+#include "disk.h"
+#include "pcb.h"
+
+// profile-guided layout of job images. the code of each hot loop is padded with NOPs in front
+// so it starts where it spans the fewest pages, and the data is moved up to start where the
+// buffers span the fewest pages. branch targets and the immediates that address data are
+// patched to match. hot code is what ran more often than the job's least run instructions in
+// a guest profile, or without one the bodies of backward branches
+namespace layout
+{
+// writes the deck out with every job that can be moved safely laid out again. a job is only
+// moved if it passes the verifier and every data address in it can be traced to the immediates
+// it came from. returns false if the file could not be written
+bool Write(Disk& disk, std::vector<PCB>& jobs, std::string path);
+}
+
+#endif // LAYOUT_H
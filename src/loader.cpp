@@ -1,4 +1,5 @@
 #include "loader.h"
+#include "isa.h"
 #include "types.h"
 #include <fstream>
 #include <iostream>
@@ -9,93 +10,498 @@
 #include <string>
 #include "memory_manager.h"
 #include <math.h>
+#include <charconv>
+#include <string.h>
+#include <thread>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace loader
 {
 
-void LoadFileToDisk(Disk& disk, std::vector<PCB>& jobs, std::string file_path)
-{	
-	std::string line; // current line being read
-	std::ifstream data_file(file_path);
+// a job's stretch of the deck, from its JOB card up to the next one
+struct DeckChunk
+{
+	const char* begin;
+	const char* end;
+	unsigned int first_line; // 1-based line number of the JOB card
+	
+	PCB* job;
+	uint32_t disk_address;
+	unsigned int num_words;
+	
+	unsigned int error_line; // 0 if the chunk parsed
+	std::string error;
+};
+
+// the line starting at begin, without its line break or trailing whitespace. returns the start of the next line
+static const char* NextLine(const char* begin, const char* end, const char*& line_end)
+{
+	const char* newline = (const char*)memchr(begin, '\n', end - begin);
+	const char* next = newline != NULL ? newline + 1 : end;
+	
+	line_end = newline != NULL ? newline : end;
+	
+	while (line_end > begin && (line_end[-1] == '\r' || line_end[-1] == ' ' || line_end[-1] == '\t'))
+	{
+		line_end--;
+	}
+	
+	return next;
+}
+
+static bool IsControlCard(const char* begin, const char* end)
+{
+	return end - begin >= 2 && begin[0] == '/' && begin[1] == '/';
+}
+
+// a whole hex number, with or without 0x in front
+static bool ParseHex(const char* begin, const char* end, uint32_t& value)
+{
+	if (end - begin > 2 && begin[0] == '0' && (begin[1] == 'x' || begin[1] == 'X'))
+	{
+		begin += 2;
+	}
+	
+	std::from_chars_result result = std::from_chars(begin, end, value, 16);
+	
+	return result.ec == std::errc() && result.ptr == end && begin != end;
+}
+
+// splits a control card into its space separated fields after the "//". returns how many there were
+static int SplitCard(const char* begin, const char* end, const char** fields, const char** field_ends, int max_fields)
+{
+	int count = 0;
+	const char* cur = begin + 2;
 	
-	if (data_file.is_open())
+	while (cur < end && count < max_fields)
 	{
-		std::cout << "opened file" << std::endl;
+		while (cur < end && (*cur == ' ' || *cur == '\t'))
+		{
+			cur++;
+		}
+		
+		if (cur == end)
+		{
+			break;
+		}
+		
+		fields[count] = cur;
 		
-		unsigned int cur_address = 0; // current address in Disk
+		while (cur < end && *cur != ' ' && *cur != '\t')
+		{
+			cur++;
+		}
+		
+		field_ends[count++] = cur;
+	}
+	
+	return count;
+}
 
-		while (getline(data_file, line)) // read each line
+static bool FieldIs(const char* begin, const char* end, const char* text)
+{
+	return (size_t)(end - begin) == strlen(text) && memcmp(begin, text, end - begin) == 0;
+}
+
+// first pass over a chunk: reads the control cards into the job and counts its words
+static void ScanChunk(DeckChunk& chunk)
+{
+	PCB& job = *chunk.job;
+	unsigned int line_number = chunk.first_line;
+	chunk.num_words = 0;
+	
+	for (const char* line = chunk.begin; line < chunk.end; line_number++)
+	{
+		const char* line_end;
+		const char* next = NextLine(line, chunk.end, line_end);
+		
+		if (IsControlCard(line, line_end))
 		{
-			if (line.substr(0, 2) == "//") // control card
+			const char* fields[5];
+			const char* field_ends[5];
+			int num_fields = SplitCard(line, line_end, fields, field_ends, 5);
+			uint32_t values[4];
+			
+			if (num_fields > 0 && FieldIs(fields[0], field_ends[0], "JOB"))
 			{
-				std::vector<std::string> controls = utils::split(line, ' '); // includes the "//"
-				
-				if (controls[1] == "JOB") // new job
+				if (num_fields < 4 || !ParseHex(fields[1], field_ends[1], values[0]) || !ParseHex(fields[2], field_ends[2], values[1]) || !ParseHex(fields[3], field_ends[3], values[2]))
 				{
-					jobs.push_back(PCB());
-
-					jobs.back().id = std::stoul(controls[2], 0, 16); // job id
-					jobs.back().program_size += std::stoul(controls[3], 0, 16) * sizeof(types::Word); // code size
-					jobs.back().priority = std::stoul(controls[4], 0, 16); // job priority
-					jobs.back().disk_address = cur_address; // disk address
+					chunk.error_line = line_number;
+					chunk.error = "JOB card needs a hex job id, code size and priority";
+					return;
 				}
 				
-				if (controls[1] == "Data")
+				job.id = values[0]; // job id
+				job.program_size += values[1] * sizeof(types::Word); // code size
+				job.priority = values[2]; // job priority
+			}
+			else if (num_fields > 0 && FieldIs(fields[0], field_ends[0], "Data"))
+			{
+				if (num_fields < 4 || !ParseHex(fields[1], field_ends[1], values[0]) || !ParseHex(fields[2], field_ends[2], values[1]) || !ParseHex(fields[3], field_ends[3], values[2]))
 				{
-					jobs.back().input_buffer_offset = jobs.back().program_size;
-					jobs.back().program_size += std::stoul(controls[2], 0, 16) * sizeof(types::Word);
-					
-					jobs.back().output_buffer_offset = jobs.back().program_size;
-					jobs.back().program_size += std::stoul(controls[3], 0, 16) * sizeof(types::Word);
-					
-					jobs.back().temp_buffer_offset = jobs.back().program_size;
-					jobs.back().program_size += std::stoul(controls[4], 0, 16) * sizeof(types::Word);
+					chunk.error_line = line_number;
+					chunk.error = "Data card needs hex input, output and temp buffer sizes";
+					return;
 				}
+				
+				job.input_buffer_offset = job.program_size;
+				job.program_size += values[0] * sizeof(types::Word);
+				
+				job.output_buffer_offset = job.program_size;
+				job.program_size += values[1] * sizeof(types::Word);
+				
+				job.temp_buffer_offset = job.program_size;
+				job.program_size += values[2] * sizeof(types::Word);
+			}
+		}
+		else if (line_end != line) // instruction Word
+		{
+			chunk.num_words++;
+		}
+		
+		line = next;
+	}
+}
+
+// second pass: decodes the words straight into the job's place on disk
+static void WriteChunk(Disk& disk, DeckChunk& chunk)
+{
+	unsigned int line_number = chunk.first_line;
+	uint32_t cur_address = chunk.disk_address;
+	
+	for (const char* line = chunk.begin; line < chunk.end; line_number++)
+	{
+		const char* line_end;
+		const char* next = NextLine(line, chunk.end, line_end);
+		
+		if (!IsControlCard(line, line_end) && line_end != line)
+		{
+			types::Word w;
+			
+			// a word is hex, or an instruction written out in assembly
+			if (!ParseHex(line, line_end, w) && !isa::Assemble(std::string(line, line_end), w))
+			{
+				chunk.error_line = line_number;
+				chunk.error = "expected a hex word or an instruction";
+				return;
 			}
-			else // instruction Word
+			
+			disk.Write(cur_address, &w, sizeof(w));
+			
+			if (cur_address - chunk.disk_address < chunk.job->input_buffer_offset)
 			{
-				types::Word w = std::stoul(line, 0, 16);
-				disk.Write(cur_address, &w, sizeof(w));
-				cur_address += sizeof(w);
+				chunk.job->min_frames = std::max(chunk.job->min_frames, (unsigned int)isa::OPCODE_TABLE[isa::OPCODE(w)].frames);
 			}
+			
+			cur_address += sizeof(w);
 		}
 		
-		data_file.close(); // close file stream
+		line = next;
+	}
+	
+	chunk.job->content_hash = ContentHash(disk, chunk.job);
+}
+
+// runs the pass over every chunk, split into contiguous runs across the hardware threads
+template<typename Pass>
+static void ForEachChunk(std::vector<DeckChunk>& chunks, Pass pass)
+{
+	unsigned int num_threads = std::max(1u, std::min((unsigned int)chunks.size(), std::thread::hardware_concurrency()));
+	std::vector<std::thread> threads;
+	
+	for (unsigned int t = 0; t < num_threads; t++)
+	{
+		size_t first = chunks.size() * t / num_threads;
+		size_t last = chunks.size() * (t + 1) / num_threads;
+		
+		threads.push_back(std::thread([&chunks, pass, first, last]()
+		{
+			for (size_t i = first; i < last; i++)
+			{
+				pass(chunks[i]);
+			}
+		}));
+	}
+	
+	for (unsigned int t = 0; t < threads.size(); t++)
+	{
+		threads[t].join();
+	}
+}
+
+// the first chunk error in deck order, printed with its line number
+static bool ReportErrors(const std::vector<DeckChunk>& chunks, const std::string& file_path)
+{
+	for (int i = 0; i < chunks.size(); i++)
+	{
+		if (chunks[i].error_line != 0)
+		{
+			std::cout << file_path << ":" << chunks[i].error_line << ": " << chunks[i].error << std::endl;
+			return false;
+		}
 	}
+	
+	return true;
+}
+
+static bool ParseDeck(Disk& disk, std::vector<PCB>& jobs, const char* text, size_t size, const std::string& file_path)
+{
+	const char* end = text + size;
+	
+	// find the JOB cards. only this scan is serial
+	std::vector<DeckChunk> chunks;
+	unsigned int line_number = 1;
+	
+	for (const char* line = text; line < end; line_number++)
+	{
+		const char* line_end;
+		const char* next = NextLine(line, end, line_end);
+		
+		const char* fields[1];
+		const char* field_ends[1];
+		
+		if (IsControlCard(line, line_end) && SplitCard(line, line_end, fields, field_ends, 1) == 1 && FieldIs(fields[0], field_ends[0], "JOB"))
+		{
+			if (!chunks.empty())
+			{
+				chunks.back().end = line;
+			}
+			
+			DeckChunk chunk;
+			chunk.begin = line;
+			chunk.end = end;
+			chunk.first_line = line_number;
+			chunk.error_line = 0;
+			chunks.push_back(chunk);
+		}
+		else if (chunks.empty() && line_end != line && !IsControlCard(line, line_end))
+		{
+			std::cout << file_path << ":" << line_number << ": word before the first JOB card" << std::endl;
+			return false;
+		}
+		
+		line = next;
+	}
+	
+	size_t first_job = jobs.size();
+	jobs.resize(first_job + chunks.size());
+	
+	for (int i = 0; i < chunks.size(); i++)
+	{
+		chunks[i].job = &jobs[first_job + i];
+	}
+	
+	ForEachChunk(chunks, [](DeckChunk& chunk) { ScanChunk(chunk); });
+	
+	if (!ReportErrors(chunks, file_path))
+	{
+		return false;
+	}
+	
+	// jobs sit back to back on disk
+	uint32_t cur_address = 0;
+	
+	for (int i = 0; i < chunks.size(); i++)
+	{
+		chunks[i].disk_address = cur_address;
+		chunks[i].job->disk_address = cur_address; // disk address
+		chunks[i].job->SizePageFlags();
+		cur_address += chunks[i].num_words * sizeof(types::Word);
+	}
+	
+	if (cur_address > Machine::DISK_SIZE)
+	{
+		std::cout << file_path << ": deck needs " << cur_address << " bytes, the disk holds " << Machine::DISK_SIZE << std::endl;
+		return false;
+	}
+	
+	ForEachChunk(chunks, [&disk](DeckChunk& chunk) { WriteChunk(disk, chunk); });
+	
+	return ReportErrors(chunks, file_path);
+}
+
+bool LoadFileToDisk(Disk& disk, std::vector<PCB>& jobs, std::string file_path)
+{
+#if defined(__unix__)
+	int fd = open(file_path.c_str(), O_RDONLY);
+	
+	if (fd < 0)
+	{
+		std::cout << "Cannot open " << file_path << std::endl;
+		return false;
+	}
+	
+	std::cout << "opened file" << std::endl;
+	
+	struct stat file_stat;
+	fstat(fd, &file_stat);
+	
+	if (file_stat.st_size == 0)
+	{
+		close(fd);
+		return true;
+	}
+	
+	void* text = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	
+	if (text == MAP_FAILED)
+	{
+		std::cout << "Cannot map " << file_path << std::endl;
+		return false;
+	}
+	
+	madvise(text, file_stat.st_size, MADV_SEQUENTIAL);
+	
+	bool parsed = ParseDeck(disk, jobs, (const char*)text, file_stat.st_size, file_path);
+	
+	munmap(text, file_stat.st_size);
+	
+	return parsed;
+#else
+	std::ifstream data_file(file_path, std::ios::binary);
+	
+	if (!data_file.is_open())
+	{
+		std::cout << "Cannot open " << file_path << std::endl;
+		return false;
+	}
+	
+	std::cout << "opened file" << std::endl;
+	
+	std::vector<char> text((std::istreambuf_iterator<char>(data_file)), std::istreambuf_iterator<char>());
+	
+	return ParseDeck(disk, jobs, text.data(), text.size(), file_path);
+#endif
 }
 
 void LoadToMemory(Disk& disk, MemManager& mmu, PCB* job) // DEPRECATED. NOW USING DEMAND PAGING
 {
 	// set up page table
-	job->page_table = mmu.Allocate(job->program_size);
+	mmu.Allocate(job->program_size, job->page_table);
 	
 	// write all pages to frames
-	for (uint32_t logical_address = 0; logical_address < job->program_size; logical_address++)
+	for (uint32_t logical_address = 0; logical_address < job->program_size; logical_address += sizeof(types::Word))
 	{
 		uint32_t effective_address = mmu.GetEffectiveAddress(logical_address, job->page_table);
 		
-		types::Byte cur_byte;
-		disk.Read(job->disk_address + logical_address, &cur_byte, sizeof(cur_byte));
-		mmu.GetMemory()->Write(effective_address, &cur_byte, sizeof(cur_byte));
+		types::Word cur_word;
+		disk.Read(job->disk_address + logical_address, &cur_word, sizeof(cur_word));
+		mmu.StoreWord(effective_address, cur_word);
 	}
 }
 
 // load single page to memory
 
 void LoadPageToMemory(Disk& disk, MemManager& mmu, PCB* job, unsigned int page_num)
+{
+	// nothing on disk past the image
+	if (!job->InImage(page_num))
+	{
+		types::Word zeros[Machine::FRAME_WORDS] = {};
+		LoadWordsToMemory(mmu, job, page_num, zeros);
+		job->anonymous_pages++;
+		return;
+	}
+	
+	uint32_t new_frame_index = mmu.AllocateFrame();
+	
+	uint32_t starting_absolute_address = mmu.GetFrameAddress(new_frame_index); // in memory
+	uint32_t disk_address = job->disk_address + (page_num << Machine::FRAME_SHIFT);
+	
+	// disk words are big-endian, memory words are host-native
+	for (uint32_t absolute_address = starting_absolute_address; absolute_address < (starting_absolute_address + Machine::FRAME_SIZE); absolute_address += sizeof(types::Word), disk_address += sizeof(types::Word))
+	{
+		types::Word cur_word;
+		disk.Read(disk_address, &cur_word, sizeof(cur_word));
+		mmu.StoreWord(absolute_address, cur_word);
+	}
+	
+	// only make the page visible once its contents are in place
+	mmu.MapPage(job, page_num, new_frame_index);
+}
+
+void LoadWordsToMemory(MemManager& mmu, PCB* job, unsigned int page_num, const types::Word* words)
 {
 	uint32_t new_frame_index = mmu.AllocateFrame();
-	job->page_table[page_num] = new_frame_index;
+	uint32_t starting_absolute_address = mmu.GetFrameAddress(new_frame_index);
+	
+	for (unsigned int i = 0; i < Machine::FRAME_WORDS; i++)
+	{
+		mmu.StoreWord(starting_absolute_address + i * sizeof(types::Word), words[i]);
+	}
 	
-	uint32_t starting_absolute_address = new_frame_index * mmu.GetFrameSize(); // in memory
-	uint32_t disk_address = job->disk_address + page_num * mmu.GetFrameSize();
+	mmu.MapPage(job, page_num, new_frame_index);
+}
+
+void ReadPageFromMemory(MemManager& mmu, PCB* job, unsigned int page_num, types::Word* words)
+{
+	uint32_t starting_absolute_address = mmu.GetFrameAddress(job->page_table[page_num]);
 	
-	for (uint32_t absolute_address = starting_absolute_address; absolute_address < (starting_absolute_address + mmu.GetFrameSize()); absolute_address++, disk_address++)
+	for (unsigned int i = 0; i < Machine::FRAME_WORDS; i++)
+	{
+		words[i] = mmu.FetchWord(starting_absolute_address + i * sizeof(types::Word));
+	}
+}
+
+void WritePageToDisk(Disk& disk, PCB* job, unsigned int page_num, const types::Word* words)
+{
+	uint32_t disk_address = job->disk_address + (page_num << Machine::FRAME_SHIFT);
+	unsigned int num_words = PageBytes(job, page_num) / sizeof(types::Word);
+	
+	// back to big-endian
+	for (unsigned int i = 0; i < num_words; i++)
+	{
+		types::Word cur_word = words[i];
+		disk.Write(disk_address + i * sizeof(types::Word), &cur_word, sizeof(cur_word));
+	}
+}
+
+uint32_t PageBytes(PCB* job, unsigned int page_num)
+{
+	uint32_t offset = page_num << Machine::FRAME_SHIFT;
+	
+	if (offset >= job->program_size)
+	{
+		return 0;
+	}
+	
+	return std::min(Machine::FRAME_SIZE, job->program_size - offset);
+}
+
+std::vector<types::Word> ReadResults(Disk& disk, PCB* job)
+{
+	std::vector<types::Word> results;
+	
+	for (uint32_t offset = job->output_buffer_offset; offset < job->temp_buffer_offset; offset += sizeof(types::Word))
+	{
+		types::Word cur_word;
+		disk.Read(job->disk_address + offset, &cur_word, sizeof(cur_word));
+		results.push_back(cur_word);
+	}
+	
+	return results;
+}
+
+uint64_t ContentHash(Disk& disk, PCB* job)
+{
+	uint64_t hash = 0xcbf29ce484222325; // FNV offset basis
+	
+	for (uint32_t offset = 0; offset < job->program_size; offset++)
 	{
 		types::Byte cur_byte;
-		disk.Read(disk_address, &cur_byte, sizeof(cur_byte));
-		mmu.GetMemory()->Write(absolute_address, &cur_byte, sizeof(cur_byte));
+		disk.Read(job->disk_address + offset, &cur_byte, sizeof(cur_byte));
+		
+		hash = (hash ^ cur_byte) * 0x100000001b3; // FNV prime
 	}
+	
+	return hash;
 }
 
 }
\ No newline at end of file
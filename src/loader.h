@@ -9,9 +9,28 @@
 
 namespace loader
 {
-void LoadFileToDisk(Disk& disk, std::vector<PCB>& jobs, std::string file_path);
+// reads a text deck onto disk. the file is mapped and split at its JOB cards, and the jobs are
+// parsed in parallel straight into their places on disk. returns false after printing the line
+// of the first error
+bool LoadFileToDisk(Disk& disk, std::vector<PCB>& jobs, std::string file_path);
 void LoadToMemory(Disk& disk, MemManager& mmu, PCB* job);
 void LoadPageToMemory(Disk& disk, MemManager& mmu, PCB* job, unsigned int page_num);
+
+// page contents as Machine::FRAME_WORDS host-native words
+void LoadWordsToMemory(MemManager& mmu, PCB* job, unsigned int page_num, const types::Word* words);
+void ReadPageFromMemory(MemManager& mmu, PCB* job, unsigned int page_num, types::Word* words);
+// writes back the page's words that are part of the image. images sit back to back on disk, so
+// the rest of a last page the image ends part way through belongs to the next job
+void WritePageToDisk(Disk& disk, PCB* job, unsigned int page_num, const types::Word* words);
+
+// bytes of the job's image in the page, less than Machine::FRAME_SIZE for a last page it ends part way through
+uint32_t PageBytes(PCB* job, unsigned int page_num);
+
+// the job's output buffer as it stands in its disk image, its results once it has finished
+std::vector<types::Word> ReadResults(Disk& disk, PCB* job);
+
+// FNV-1a hash of the job's disk image
+uint64_t ContentHash(Disk& disk, PCB* job);
 }
 
 #endif // LOADER_H
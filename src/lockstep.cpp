@@ -0,0 +1,569 @@
+#include "lockstep.h"
+#include <iostream>
+#include "isa.h"
+
+Lockstep::Lockstep(Disk& disk)
+	: disk_(disk)
+{
+	groups_ = 0;
+	steps_ = 0;
+	lane_instructions_ = 0;
+}
+
+bool Lockstep::SameProgram(PCB& a, PCB& b)
+{
+	if (a.program_size != b.program_size || a.input_buffer_offset != b.input_buffer_offset ||
+		a.output_buffer_offset != b.output_buffer_offset || a.temp_buffer_offset != b.temp_buffer_offset)
+	{
+		return false;
+	}
+	
+	for (uint32_t address = 0; address < a.input_buffer_offset; address += sizeof(types::Word))
+	{
+		types::Word word_a, word_b;
+		disk_.Read(a.disk_address + address, &word_a, sizeof(word_a));
+		disk_.Read(b.disk_address + address, &word_b, sizeof(word_b));
+		
+		if (word_a != word_b)
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+void Lockstep::Load(std::vector<PCB*>& jobs)
+{
+	// the interpreter sees whole pages, including whatever follows the image in its last one
+	num_words_ = Machine::PagesFor(jobs[0]->program_size) * Machine::FRAME_WORDS;
+	image_words_ = jobs[0]->program_size / sizeof(types::Word);
+	memory_.assign(num_words_ * LANES, 0);
+	
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		jobs_[lane] = lane < jobs.size() ? jobs[lane] : NULL;
+		running_[lane] = jobs_[lane] != NULL;
+		mask_[lane] = 0;
+		pc_[lane] = 0;
+		beyond_[lane].clear();
+		
+		for (unsigned int r = 0; r < Machine::REGISTER_COUNT; r++)
+		{
+			registers_[r][lane] = jobs_[lane] != NULL ? jobs_[lane]->registers[r] : 0;
+		}
+		
+		if (jobs_[lane] == NULL)
+		{
+			continue;
+		}
+		
+		pc_[lane] = jobs_[lane]->program_counter;
+		jobs_[lane]->status = PCB::RUNNING;
+		
+		for (unsigned int w = 0; w < num_words_; w++)
+		{
+			disk_.Read(jobs_[lane]->disk_address + w * sizeof(types::Word), &memory_[w * LANES + lane], sizeof(types::Word));
+		}
+	}
+}
+
+void Lockstep::Run(std::vector<PCB>& jobs)
+{
+	std::vector<bool> grouped(jobs.size(), false);
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		if (grouped[i])
+		{
+			continue;
+		}
+		
+		std::vector<PCB*> group;
+		
+		for (int j = i; j < jobs.size() && group.size() < LANES; j++)
+		{
+			if (!grouped[j] && (j == i || SameProgram(jobs[i], jobs[j])))
+			{
+				group.push_back(&jobs[j]);
+				grouped[j] = true;
+			}
+		}
+		
+		Load(group);
+		RunGroup();
+		groups_++;
+	}
+}
+
+void Lockstep::RunGroup()
+{
+	unsigned long start = steps_;
+	
+	while (Step())
+	{
+		for (unsigned int lane = 0; lane < LANES; lane++)
+		{
+			if (jobs_[lane] != NULL && jobs_[lane]->finish_time < 0 && !running_[lane])
+			{
+				jobs_[lane]->finish_time = steps_ - start;
+			}
+		}
+	}
+	
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		PCB* job = jobs_[lane];
+		
+		if (job == NULL)
+		{
+			continue;
+		}
+		
+		job->program_counter = pc_[lane];
+		
+		for (unsigned int r = 0; r < Machine::REGISTER_COUNT; r++)
+		{
+			job->registers[r] = registers_[r][lane];
+		}
+		
+		for (unsigned int w = 0; w < image_words_; w++)
+		{
+			disk_.Write(job->disk_address + w * sizeof(types::Word), &memory_[w * LANES + lane], sizeof(types::Word));
+		}
+	}
+}
+
+void Lockstep::Stop(unsigned int lane, const char* error)
+{
+	running_[lane] = 0;
+	mask_[lane] = 0;
+	jobs_[lane]->status = PCB::TERMINATED;
+	
+	if (error != NULL)
+	{
+		std::cout << error << std::endl;
+	}
+}
+
+types::Word* Lockstep::WordAt(unsigned int lane, uint32_t address)
+{
+	if (address % sizeof(types::Word) != 0)
+	{
+		return NULL;
+	}
+	
+	uint32_t word = address / sizeof(types::Word);
+	
+	return word < num_words_ ? &memory_[word * LANES + lane] : &beyond_[lane][word];
+}
+
+void Lockstep::Gather(const uint32_t* addresses, types::Word* values)
+{
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		if (!mask_[lane])
+		{
+			continue;
+		}
+		
+		types::Word* word = WordAt(lane, addresses[lane]);
+		
+		if (word == NULL)
+		{
+			Stop(lane, "ADDRESS ERROR");
+			continue;
+		}
+		
+		values[lane] = *word;
+	}
+}
+
+void Lockstep::Scatter(const uint32_t* addresses, const types::Word* values)
+{
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		if (!mask_[lane])
+		{
+			continue;
+		}
+		
+		types::Word* word = WordAt(lane, addresses[lane]);
+		
+		if (word == NULL)
+		{
+			Stop(lane, "ADDRESS ERROR");
+			continue;
+		}
+		
+		*word = values[lane];
+	}
+}
+
+void Lockstep::Block(const isa::Instruction& instruction)
+{
+	types::Word (&r)[Machine::REGISTER_COUNT][LANES] = registers_;
+	bool has_source = instruction.opcode != isa::BFIL;
+	bool has_destination = instruction.opcode == isa::BCPY || instruction.opcode == isa::BFIL || instruction.opcode == isa::VADD;
+	
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		while (mask_[lane] && r[instruction.reg3][lane] > 0)
+		{
+			types::Word* source = has_source ? WordAt(lane, r[instruction.reg1][lane]) : &memory_[lane];
+			types::Word* destination = has_destination ? WordAt(lane, r[instruction.reg2][lane]) : &memory_[lane];
+			
+			if (source == NULL || destination == NULL)
+			{
+				Stop(lane, "ADDRESS ERROR");
+				break;
+			}
+			
+			types::Word& from = *source;
+			types::Word& to = *destination;
+			
+			switch (instruction.opcode)
+			{
+				case isa::BCPY: to = from; break;
+				case isa::BFIL: to = r[instruction.reg1][lane]; break;
+				case isa::VADD: to += from; break;
+				case isa::VSUM: r[instruction.reg2][lane] += from; break;
+				case isa::VMIN: r[instruction.reg2][lane] = from < r[instruction.reg2][lane] ? from : r[instruction.reg2][lane]; break;
+				case isa::VMAX: r[instruction.reg2][lane] = from > r[instruction.reg2][lane] ? from : r[instruction.reg2][lane]; break;
+			}
+			
+			if (has_source)
+			{
+				r[instruction.reg1][lane] += sizeof(types::Word);
+			}
+			
+			if (has_destination)
+			{
+				r[instruction.reg2][lane] += sizeof(types::Word);
+			}
+			
+			r[instruction.reg3][lane]--;
+		}
+	}
+}
+
+// dest = op(lane) in every masked lane
+#define LANE_APPLY(dest, op) \
+	for (unsigned int l = 0; l < LANES; l++) \
+	{ \
+		types::Word value = (op); \
+		dest[l] = mask_[l] ? value : dest[l]; \
+	}
+
+// every masked lane for which cond holds branches to the instruction's address
+#define LANE_BRANCH(cond) \
+	for (unsigned int l = 0; l < LANES; l++) \
+	{ \
+		pc_[l] = mask_[l] && (cond) ? instruction.address - sizeof(types::Word) : pc_[l]; \
+	}
+
+bool Lockstep::Step()
+{
+	// lanes that went apart are run lowest PC first, so a loop's stragglers catch up
+	uint32_t pc = 0xFFFFFFFF;
+	unsigned int first = LANES;
+	
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		if (running_[lane] && pc_[lane] < pc)
+		{
+			pc = pc_[lane];
+			first = lane;
+		}
+	}
+	
+	if (first == LANES)
+	{
+		return false;
+	}
+	
+	if (pc % sizeof(types::Word) != 0)
+	{
+		for (unsigned int lane = 0; lane < LANES; lane++)
+		{
+			if (running_[lane] && pc_[lane] == pc)
+			{
+				Stop(lane, "ADDRESS ERROR");
+			}
+		}
+		
+		return true;
+	}
+	
+	// a lane that stored over its code goes on its own
+	types::Word word = *WordAt(first, pc);
+	
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		mask_[lane] = running_[lane] && pc_[lane] == pc && *WordAt(lane, pc) == word;
+	}
+	
+	const isa::Instruction instruction = isa::Decode(word);
+	types::Word (&r)[Machine::REGISTER_COUNT][LANES] = registers_;
+	
+	alignas(32) uint32_t addresses[LANES] = {};
+	alignas(32) types::Word values[LANES] = {};
+	
+	switch (instruction.opcode)
+	{
+		case isa::RD:
+		{
+			LANE_APPLY(addresses, instruction.reg2 > 0 ? (uint16_t)r[instruction.reg2][l] : instruction.address);
+			Gather(addresses, values);
+			LANE_APPLY(r[instruction.reg1], values[l]);
+			break;
+		}
+		
+		case isa::WR:
+		{
+			LANE_APPLY(addresses, instruction.address == 0 ? r[instruction.reg2][l] : instruction.address);
+			Scatter(addresses, r[instruction.reg1]);
+			break;
+		}
+		
+		case isa::ST:
+		{
+			LANE_APPLY(addresses, instruction.address + r[instruction.reg2][l]);
+			Scatter(addresses, r[instruction.reg1]);
+			break;
+		}
+		
+		case isa::LW:
+		{
+			LANE_APPLY(addresses, instruction.address + r[instruction.reg1][l]);
+			Gather(addresses, values);
+			LANE_APPLY(r[instruction.reg2], values[l]);
+			break;
+		}
+		
+		case isa::MOV:
+		{
+			LANE_APPLY(r[instruction.reg1], r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::ADD:
+		{
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] + r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::SUB:
+		{
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] - r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::MUL:
+		{
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] * r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::DIV:
+		{
+			for (unsigned int lane = 0; lane < LANES; lane++)
+			{
+				if (mask_[lane] && r[instruction.reg2][lane] == 0)
+				{
+					Stop(lane, "DIVIDE BY ZERO");
+				}
+			}
+			
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] / (r[instruction.reg2][l] != 0 ? r[instruction.reg2][l] : 1));
+			break;
+		}
+		
+		case isa::AND:
+		{
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] & r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::OR:
+		{
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] | r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::MOVI:
+		case isa::LDI:
+		{
+			LANE_APPLY(r[instruction.reg2], instruction.address);
+			break;
+		}
+		
+		case isa::LUI:
+		{
+			LANE_APPLY(r[instruction.reg2], (types::Word)instruction.address << 16);
+			break;
+		}
+		
+		case isa::ADDI:
+		{
+			LANE_APPLY(r[instruction.reg2], r[instruction.reg2][l] + instruction.address);
+			break;
+		}
+		
+		case isa::MULI:
+		{
+			LANE_APPLY(r[instruction.reg2], r[instruction.reg2][l] * instruction.address);
+			break;
+		}
+		
+		case isa::DIVI:
+		{
+			if (instruction.address == 0)
+			{
+				for (unsigned int lane = 0; lane < LANES; lane++)
+				{
+					if (mask_[lane])
+					{
+						Stop(lane, "DIVIDE BY ZERO");
+					}
+				}
+				
+				break;
+			}
+			
+			LANE_APPLY(r[instruction.reg2], r[instruction.reg2][l] / instruction.address);
+			break;
+		}
+		
+		case isa::SLT:
+		{
+			LANE_APPLY(r[instruction.reg3], r[instruction.reg1][l] < r[instruction.reg2][l] ? 1 : 0);
+			break;
+		}
+		
+		case isa::SLTI:
+		{
+			LANE_APPLY(r[instruction.reg2], r[instruction.reg1][l] < instruction.address ? 1 : 0);
+			break;
+		}
+		
+		case isa::HLT:
+		{
+			for (unsigned int lane = 0; lane < LANES; lane++)
+			{
+				if (mask_[lane])
+				{
+					jobs_[lane]->instructions++;
+					lane_instructions_++;
+					Stop(lane, NULL);
+				}
+			}
+			
+			break;
+		}
+		
+		case isa::JMP:
+		{
+			LANE_BRANCH(true);
+			break;
+		}
+		
+		case isa::BEQ:
+		{
+			LANE_BRANCH(r[instruction.reg1][l] == r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::BNE:
+		{
+			LANE_BRANCH(r[instruction.reg1][l] != r[instruction.reg2][l]);
+			break;
+		}
+		
+		case isa::BEZ:
+		{
+			LANE_BRANCH(r[instruction.reg1][l] == 0);
+			break;
+		}
+		
+		case isa::BNZ:
+		{
+			LANE_BRANCH(r[instruction.reg1][l] != 0);
+			break;
+		}
+		
+		case isa::BGZ:
+		{
+			LANE_BRANCH(!(r[instruction.reg1][l] & 0x80000000));
+			break;
+		}
+		
+		case isa::BLZ:
+		{
+			LANE_BRANCH(r[instruction.reg1][l] & 0x80000000);
+			break;
+		}
+		
+		case isa::BCPY:
+		case isa::BFIL:
+		case isa::VADD:
+		case isa::VSUM:
+		case isa::VMIN:
+		case isa::VMAX:
+		{
+			Block(instruction);
+			break;
+		}
+		
+		case isa::CSWP:
+		{
+			alignas(32) uint32_t next[LANES] = {};
+			alignas(32) types::Word seconds[LANES] = {};
+			alignas(32) types::Word swapped[LANES] = {};
+			
+			LANE_APPLY(addresses, r[instruction.reg1][l] + instruction.address);
+			LANE_APPLY(next, addresses[l] + sizeof(types::Word));
+			Gather(addresses, values);
+			Gather(next, seconds);
+			
+			LANE_APPLY(swapped, values[l] > seconds[l] ? 1 : 0);
+			
+			for (unsigned int l = 0; l < LANES; l++)
+			{
+				types::Word first = values[l];
+				values[l] = swapped[l] ? seconds[l] : first;
+				seconds[l] = swapped[l] ? first : seconds[l];
+			}
+			
+			Scatter(addresses, values);
+			Scatter(next, seconds);
+			LANE_APPLY(r[instruction.reg2], swapped[l]);
+			break;
+		}
+		
+		default: // NOP, and unused opcodes do nothing as on the CPU
+		{
+			break;
+		}
+	}
+	
+	steps_++;
+	
+	for (unsigned int lane = 0; lane < LANES; lane++)
+	{
+		if (mask_[lane])
+		{
+			pc_[lane] += sizeof(types::Word);
+			jobs_[lane]->instructions++;
+			lane_instructions_++;
+		}
+	}
+	
+	return true;
+}
+
+void Lockstep::PrintStatistics()
+{
+	std::cout << std::dec << "Lockstep: " << groups_ << " groups of up to " << LANES << " lanes, " << lane_instructions_ << " lane instructions in "
+			  << steps_ << " steps (" << (steps_ > 0 ? 100.0 * lane_instructions_ / (steps_ * LANES) : 0) << "% of lanes busy)" << std::endl;
+}
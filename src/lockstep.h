@@ -0,0 +1,75 @@
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+#include "disk.h"
+#include "pcb.h"
+#include "types.h"
+#include "isa.h"
+
+// runs jobs that share the same code and memory layout side by side, one job per lane.
+// registers and memory are held structure-of-arrays, a value per lane next to each other,
+// and every instruction is applied to all lanes at its PC under a mask, so the lane loops
+// vectorize. lanes that branch apart are run at the lowest PC first and join up again once
+// their PCs meet. each lane's image pages are a flat copy of its job's, there is no paging.
+// pages past the image are zero filled when first touched, as in the interpreter
+class Lockstep
+{
+public:
+	static const unsigned int LANES = 8; // 32-bit words per 256-bit vector
+
+private:
+	Disk& disk_;
+	
+	// the group being run
+	unsigned int num_words_; // words in each lane's image pages
+	unsigned int image_words_; // of those, the words of the image, written back at the end
+	std::vector<types::Word> memory_; // word * LANES + lane
+	std::map<uint32_t, types::Word> beyond_[LANES]; // words past the image pages by word index, zero until stored
+	alignas(32) types::Word registers_[Machine::REGISTER_COUNT][LANES];
+	alignas(32) uint32_t pc_[LANES];
+	alignas(32) uint32_t running_[LANES]; // 1 while the lane has not stopped
+	alignas(32) uint32_t mask_[LANES]; // 1 for lanes taking the current instruction
+	PCB* jobs_[LANES]; // NULL for unused lanes
+	
+	// statistics
+	unsigned long groups_;
+	unsigned long steps_; // instructions issued across all lanes at once
+	unsigned long lane_instructions_;
+	
+	// the same code words and layout, so the jobs can share one instruction stream
+	bool SameProgram(PCB& a, PCB& b);
+	
+	void Load(std::vector<PCB*>& jobs);
+	
+	// runs the lanes until they have all stopped, then writes their images back to disk
+	void RunGroup();
+	
+	// issues one instruction to the lanes at the lowest PC. returns false when none are running
+	bool Step();
+	
+	// the lane's word at a logical address, NULL if it is not word aligned
+	types::Word* WordAt(unsigned int lane, uint32_t address);
+	
+	// reads or writes a word for every masked lane, lanes using an unaligned address stop
+	void Gather(const uint32_t* addresses, types::Word* values);
+	void Scatter(const uint32_t* addresses, const types::Word* values);
+	
+	// runs a block or vector instruction in every masked lane, a word at a time
+	void Block(const isa::Instruction& instruction);
+	
+	// takes the lane out with an error, the way the CPU terminates a process
+	void Stop(unsigned int lane, const char* error);
+
+public:
+	Lockstep(Disk& disk);
+	
+	// runs every job to completion, grouping those that match up to LANES at a time
+	void Run(std::vector<PCB>& jobs);
+	
+	void PrintStatistics();
+};
+
+#endif // LOCKSTEP_H
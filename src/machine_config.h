@@ -0,0 +1,75 @@
+#ifndef MACHINE_CONFIG_H
+#define MACHINE_CONFIG_H
+
+#include <stdint.h>
+
+// compile-time VM geometry. everything sized by the machine is specialized on one of these,
+// so address math folds down to shifts and masks
+template<unsigned int FRAME_BYTES, unsigned int REGISTERS, unsigned int PAGE_TABLE_ENTRIES, unsigned int RAM_BYTES, unsigned int DISK_BYTES, unsigned int CPUS>
+struct MachineConfig
+{
+	static_assert(FRAME_BYTES >= 4 && (FRAME_BYTES & (FRAME_BYTES - 1)) == 0, "frame size must be a power of two number of bytes, at least one word");
+	static_assert(REGISTERS >= 2 && REGISTERS <= 16 && (REGISTERS & (REGISTERS - 1)) == 0, "register fields are 4 bits, and register 1 is the zero register");
+	static_assert(RAM_BYTES % FRAME_BYTES == 0, "RAM must hold whole frames");
+	
+	static constexpr unsigned int Log2(unsigned int value)
+	{
+		return value <= 1 ? 0 : 1 + Log2(value / 2);
+	}
+	
+	static constexpr unsigned int FRAME_SIZE = FRAME_BYTES;
+	static constexpr unsigned int FRAME_SHIFT = Log2(FRAME_BYTES);
+	static constexpr uint32_t OFFSET_MASK = FRAME_BYTES - 1;
+	static constexpr unsigned int FRAME_WORDS = FRAME_BYTES / 4;
+	
+	static constexpr unsigned int REGISTER_COUNT = REGISTERS;
+	static constexpr unsigned int REGISTER_MASK = REGISTERS - 1;
+	
+	static constexpr unsigned int PAGE_TABLE_LENGTH = PAGE_TABLE_ENTRIES;
+	
+	static constexpr unsigned int RAM_SIZE = RAM_BYTES;
+	static constexpr unsigned int NUM_FRAMES = RAM_BYTES / FRAME_BYTES;
+	static constexpr unsigned int DISK_SIZE = DISK_BYTES;
+	
+	static constexpr unsigned int CPU_COUNT = CPUS;
+	
+	static constexpr uint32_t PageOf(uint32_t logical_address)
+	{
+		return logical_address >> FRAME_SHIFT;
+	}
+	
+	static constexpr uint32_t OffsetOf(uint32_t logical_address)
+	{
+		return logical_address & OFFSET_MASK;
+	}
+	
+	// pages needed to hold num_bytes
+	static constexpr unsigned int PagesFor(unsigned int num_bytes)
+	{
+		return (num_bytes + OFFSET_MASK) >> FRAME_SHIFT;
+	}
+};
+
+namespace presets
+{
+// the machine the course project specifies: 4 word frames, 1K words of RAM, 2K words of disk
+typedef MachineConfig<16, 16, 0x40, 1024 * 4, 2048 * 4, 4> Production;
+
+// fewer, bigger pages
+typedef MachineConfig<64, 16, 0x10, 1024 * 4, 2048 * 4, 4> LargeFrames;
+
+// RAM for about one job at a time, for memory pressure experiments
+typedef MachineConfig<16, 16, 0x40, 512, 2048 * 4, 4> SmallRam;
+}
+
+// the geometry this build is specialized on. other presets are separate builds, picked with
+// -DVM_PRESET_LARGE_FRAMES or -DVM_PRESET_SMALL_RAM
+#if defined(VM_PRESET_LARGE_FRAMES)
+typedef presets::LargeFrames Machine;
+#elif defined(VM_PRESET_SMALL_RAM)
+typedef presets::SmallRam Machine;
+#else
+typedef presets::Production Machine;
+#endif
+
+#endif // MACHINE_CONFIG_H
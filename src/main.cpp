@@ -1,132 +1,251 @@
 #include <iostream>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <math.h>
 #include "pcb.h"
 #include "disk.h"
 #include "memory.h"
 #include "memory_manager.h"
+#include "memory_groups.h"
 #include "loader.h"
 #include "cpu.h"
 #include "metrics.h"
+#include "options.h"
+#include "profile_store.h"
+#include "scheduler.h"
+#include "cache.h"
+#include "pipeline.h"
+#include "disk_model.h"
+#include "verifier.h"
+#include "simulator.h"
+#include "compressed_swap.h"
+#include "write_back.h"
+#include "host_counters.h"
+#include "guest_profiler.h"
+#include "lockstep.h"
+#include "distributed.h"
+#include "io_channels.h"
+#include "result_cache.h"
+#include "translator.h"
+#include "layout.h"
 
-Disk disk = Disk(2048 * 4);
+Disk disk = Disk(Machine::DISK_SIZE);
 
-Memory ram = Memory(1024 * 4);
-MemManager mmu(&ram, 16); // 4 words per frame
+Memory ram = Memory(Machine::RAM_SIZE);
+MemManager mmu(&ram);
 	
-const int CPU_COUNT = 4;
+const int CPU_COUNT = Machine::CPU_COUNT;
+const int WRITE_BACK_BATCH = 8; // dirty pages collected before they are written out
 CPU* cpus[CPU_COUNT];
 
 std::vector<PCB> programs;
 
-std::queue<PCB*> ready_queue;
-std::queue<PCB*> wait_queue;
+std::deque<PCB*> ready_queue;
 
-int main()
+ProfileStore profiles;
+
+// each finished job's output buffer, read back from disk
+static void PrintResults()
+{
+	std::cout << std::endl << "Results read back from disk (ordered by job ID):" << std::endl;
+	
+	for (int i = 0; i < programs.size(); i++)
+	{
+		if (programs[i].finish_time < 0)
+		{
+			continue;
+		}
+		
+		std::vector<types::Word> results = loader::ReadResults(disk, &programs[i]);
+		std::cout << std::dec << "Job " << programs[i].id << ":" << std::hex;
+		
+		for (int j = 0; j < results.size(); j++)
+		{
+			std::cout << " " << results[j];
+		}
+		
+		std::cout << std::dec << std::endl;
+	}
+}
+
+int main(int argc, char* argv[])
 {
+	if (!options::Parse(argc, argv))
+	{
+		return 1;
+	}
+	
+	// workers get their jobs from the coordinator, not the deck
+	if (options::worker_socket != "")
+	{
+		return distributed::RunWorker(options::worker_socket) ? 0 : 1;
+	}
+	
+	if (options::host_mapped && !mmu.EnableHostMapping())
+	{
+		std::cout << "Host mapped memory not available, using page tables" << std::endl;
+		options::host_mapped = false;
+	}
+	
 	std::cout << "Start:" << std::endl;
 	
+	if (options::host_counters)
+	{
+		host_counters::Open();
+	}
+	
 	// initialize CPUs
-	for (int i = 0; i < 4; i++)
+	for (int i = 0; i < CPU_COUNT; i++)
 	{
-		cpus[i] = new CPU(&mmu);
+		cpus[i] = new CPU(&mmu, i);
 	}
 	
 	// programs' data loaded into disk
-	loader::LoadFileToDisk(disk, programs, "..\\DataFile.txt");
+	host_counters::Enter(host_counters::LOAD);
 	
-	// LONG-TERM SCHEDULER
-	// determines order in which programs are loaded into ready_queue
-	enum POLICIES {FCFS, PRIORITY, SJF};
+	if (!loader::LoadFileToDisk(disk, programs, "..\\DataFile.txt"))
+	{
+		return 1;
+	}
 	
-	// get input for scheduling policy
-	std::cout << "Enter scheduling policy [FCFS, PRIORITY, SJF] (0/1/2):" << std::endl;
-	int p;
-	std::cin >> p;
+	// the precompiled job library is regenerated from the deck
+	if (options::translate_path != "")
+	{
+		return translator::Translate(disk, programs, options::translate_path) ? 0 : 1;
+	}
+	
+	// the deck is written out again with its hot code and data in fewer pages
+	if (options::layout_path != "")
+	{
+		if (options::layout_profile != "" && !guest_profiler::Read(options::layout_profile, programs))
+		{
+			return 1;
+		}
+		
+		return layout::Write(disk, programs, options::layout_path) ? 0 : 1;
+	}
 	
-	POLICIES policy = static_cast<POLICIES>(p);
+	// jobs streaming through host files start on their first record
+	IoChannels channels(disk, mmu);
+	bool streaming = !options::input_files.empty() || !options::output_files.empty();
 	
-	switch (policy)
+	for (int i = 0; i < programs.size(); i++)
 	{
-		case FCFS:
+		std::string input_path = options::input_files.count(programs[i].id) != 0 ? options::input_files[programs[i].id] : "";
+		std::string output_path = options::output_files.count(programs[i].id) != 0 ? options::output_files[programs[i].id] : "";
+		
+		if ((input_path != "" || output_path != "") && !channels.Attach(programs[i], input_path, output_path))
 		{
-			for (int i = 0; i < programs.size(); i++)
-			{
-				ready_queue.push(&programs[i]);
-				ready_queue.front()->status = PCB::READY;
-			}
-			
-			break;
+			return 1;
 		}
+	}
+	
+	if (options::verify)
+	{
+		int num_verified = 0;
 		
-		case PRIORITY:
+		for (int i = 0; i < programs.size(); i++)
 		{
-			PCB* temp[programs.size()];
-			int tempsize = programs.size();
+			verifier::Report report = verifier::Verify(disk, programs[i]);
+			
+			programs[i].verified = report.verified;
+			programs[i].footprint = report.footprint;
 			
-			for (int i = 0; i < programs.size(); i++)
+			if (report.verified)
 			{
-				temp[i] = &programs[i];
+				num_verified++;
 			}
-			
-			int highest_priority_index;
-			
-			while (ready_queue.size() < programs.size())
+			else
 			{
-				highest_priority_index = 0;
-				
-				for (int i = 0; i < tempsize; i++)
-				{
-					if (temp[i]->priority > temp[highest_priority_index]->priority)
-					{
-						highest_priority_index = i;
-					}
-				}
-				
-				ready_queue.push(temp[highest_priority_index]);
-				temp[highest_priority_index] = temp[tempsize - 1];
-				tempsize--;
+				std::cout << "Job " << programs[i].id << " not verified: " << report.reason << std::endl;
 			}
-			
-			break;
 		}
 		
-		case SJF:
+		std::cout << num_verified << " of " << programs.size() << " jobs verified" << std::endl;
+	}
+	
+	// after verification, a verified job that does not fit in its group's quota is paged instead
+	MemoryGroups groups(mmu);
+	
+	if (!groups.Configure(options::memory_groups, programs))
+	{
+		return 1;
+	}
+	
+	if (options::profile_path != "")
+	{
+		profiles.Load(options::profile_path);
+	}
+	
+	if (options::guest_profile != "")
+	{
+		guest_profiler::Enable(programs);
+	}
+	
+	// the timing models and the guest profiler see every access through the interpreter.
+	// verified and host mapped jobs keep their own interpreters
+	if (options::native && !options::cache_model && !options::pipeline_model && options::guest_profile == "")
+	{
+		int num_native = 0;
+		
+		for (int i = 0; i < programs.size(); i++)
 		{
-			PCB* temp[programs.size()];
-			int tempsize = programs.size();
-			
-			for (int i = 0; i < programs.size(); i++)
-			{
-				temp[i] = &programs[i];
-			}
-			
-			int shortest_job_index;
+			programs[i].native = native::Find(programs[i].content_hash);
 			
-			while (ready_queue.size() < programs.size())
+			if (programs[i].native != NULL)
 			{
-				shortest_job_index = 0;
-				
-				for (int i = 0; i < tempsize; i++)
-				{
-					if (temp[i]->input_buffer_offset < temp[shortest_job_index]->input_buffer_offset)
-					{
-						shortest_job_index = i;
-					}
-				}
-				
-				ready_queue.push(temp[shortest_job_index]);
-				temp[shortest_job_index] = temp[tempsize - 1];
-				tempsize--;
+				num_native++;
 			}
-			
-			break;
 		}
-	}	
+		
+		std::cout << num_native << " of " << programs.size() << " jobs precompiled" << std::endl;
+	}
+	
+	if (options::coordinator_socket != "")
+	{
+		if (!distributed::Coordinate(disk, programs, options::coordinator_socket, options::workers))
+		{
+			return 1;
+		}
+		
+		if (options::print_results)
+		{
+			PrintResults();
+		}
+		
+		return 0;
+	}
+	
+	// replicas of the same code run side by side instead of being scheduled
+	if (options::lockstep)
+	{
+		Lockstep lockstep(disk);
+		lockstep.Run(programs);
+		lockstep.PrintStatistics();
+		
+		if (options::print_results)
+		{
+			PrintResults();
+		}
+		
+		return 0;
+	}
+	
+	host_counters::Enter(host_counters::NONE);
+	
+	// get input for scheduling policy
+	std::cout << "Enter scheduling policy [FCFS, PRIORITY, SJF, SRTF] (0/1/2/3):" << std::endl;
+	int p;
+	std::cin >> p;
+	
+	scheduler::POLICIES policy = static_cast<scheduler::POLICIES>(p);
+	
+	host_counters::Enter(host_counters::SCHEDULE);
+	scheduler::Admit(policy, programs, ready_queue, profiles);
+	host_counters::Enter(host_counters::NONE);
 	
 	// get input for number of CPUs to use
-	std::cout << "Number of CPUs to use (1-4):" << std::endl;
+	std::cout << "Number of CPUs to use (1-" << CPU_COUNT << "):" << std::endl;
 	int c;
 	std::cin >> c;
 	
@@ -134,94 +253,64 @@ int main()
 	int n;
 	std::cin >> n;
 	
-	float max_ram_usage = 0;
+	scheduler::RunQueues run_queues(c, options::migration_threshold);
+	
+	CacheHierarchy caches(c, options::l1_cache, options::l2_cache, options::memory_latency);
+	
+	if (options::cache_model)
+	{
+		mmu.SetCacheHierarchy(&caches);
+	}
 	
-	int programs_to_execute = n;
+	std::vector<Pipeline> pipelines(c, Pipeline(options::branch_predictor, options::pipeline));
 	
-	while (programs_to_execute > 0)
+	if (options::pipeline_model)
 	{
-		// SHORT-TERM SCHEDULER & M-DISPATCHER
-		for (int cpu_index = 0; cpu_index < c; cpu_index++)
+		for (int i = 0; i < c; i++)
 		{
-			CPU*& cpu = cpus[cpu_index]; // cpu just an alias for current cpu
-			
-			// cpu idle
-			if (cpu->GetCurrentProcess() == NULL || cpu->GetCurrentProcess()->status == PCB::TERMINATED || cpu->GetCurrentProcess()->status == PCB::WAITING)
-			{
-				// pick an available program/process
-				if (!wait_queue.empty())
-				{
-					cpu->SetCurrentProcess(wait_queue.front());
-					
-					wait_queue.front()->cpu_id = cpu_index;
-					wait_queue.pop();
-				}
-				else if (!ready_queue.empty())
-				{
-					cpu->SetCurrentProcess(ready_queue.front());
-					
-					// load first 4 frames of process into memory
-					for (int i = 0; i < 4; i++)
-					{
-						loader::LoadPageToMemory(disk, mmu, ready_queue.front(), i);
-					}
-					
-					ready_queue.front()->cpu_id = cpu_index;
-					ready_queue.pop();
-				}
-			}
-			
-			if (cpu->GetCurrentProcess() != NULL && cpu->GetCurrentProcess()->status != PCB::TERMINATED)
-			{
-				PCB::STATUS& status = cpu->GetCurrentProcess()->status;
-				
-				if (status == PCB::RUNNING)
-				{
-					cpu->Execute();
-					cpu->GetCurrentProcess()->completion_time++;
-				}
-				
-				if (status == PCB::BLOCKED) // service page fault
-				{
-					status = PCB::WAITING;
-					loader::LoadPageToMemory(disk, mmu, cpu->GetCurrentProcess(), cpu->GetCurrentProcess()->page_fault_index);
-					cpu->GetCurrentProcess()->cpu_id = -1;
-					wait_queue.push(cpu->GetCurrentProcess());
-				}
-				
-				if (status == PCB::WAITING)
-				{
-					
-				}
-				
-				if (status == PCB::TERMINATED)
-				{
-					mmu.PrintFrames(cpu->GetCurrentProcess());
-					
-					programs_to_execute--;
-					cpu->GetCurrentProcess()->cpu_id = -1;
-					mmu.Release(cpu->GetCurrentProcess()->page_table, ceil(cpu->GetCurrentProcess()->program_size / (float)mmu.GetFrameSize()));
-				}
-			}
+			cpus[i]->SetPipeline(&pipelines[i]);
 		}
+	}
+	
+	// times are in ticks, one instruction each
+	DiskModelConfig disk_config;
+	disk_config.ssd = options::disk_model == "ssd";
+	disk_config.track_size = 512;
+	disk_config.seek_settle = 20;
+	disk_config.seek_per_track = 2;
+	disk_config.rotation = 60;
+	disk_config.access_latency = 25;
+	disk_config.transfer_per_word = 1;
+	
+	DiskDevice disk_device(disk_config, options::io_policy, options::io_deadline);
+	
+	WriteBack write_back(disk, WRITE_BACK_BATCH);
+	CompressedSwap swap(write_back, options::swap_budget);
+	
+	// jobs that ran before skip executing. streaming jobs change their image as they go, and
+	// group quotas change how jobs page
+	ResultCache results(options::resident_limit);
+	bool memoize = options::result_cache != "" && !streaming && options::memory_groups.empty();
+	
+	if (memoize)
+	{
+		results.Load(options::result_cache);
 		
-		// METRICS
-		metrics::time++;
+		// the timing models and the guest profiler need the instructions executed, and the
+		// compressed swap tier behaves by the contents of the pages
+		bool replay = !options::cache_model && !options::pipeline_model && options::guest_profile == "" && options::swap_budget == 0;
 		
-		for (int i = 0; i < programs.size(); i++)
+		for (int i = 0; i < programs.size() && replay; i++)
 		{
-			if (programs[i].status != PCB::TERMINATED && programs[i].cpu_id == -1)
-			{
-				programs[i].wait_time++;
-			}
-		}
-		
-		if (mmu.PercentageUsed() > max_ram_usage)
-		{
-			max_ram_usage = mmu.PercentageUsed();
+			results.Prepare(programs[i]);
 		}
 	}
 	
+	Simulator simulator(disk, mmu, cpus, c, policy, ready_queue, run_queues, profiles, options::disk_model != "" ? &disk_device : NULL, options::swap_budget > 0 ? &swap : NULL, write_back, streaming ? &channels : NULL, memoize ? &results : NULL, groups);
+	host_counters::Enter(host_counters::SCHEDULE);
+	simulator.Run(programs, n);
+	host_counters::Enter(host_counters::REPORT);
+	
 	std::cout << "EXECUTION COMPLETE" << std::endl << std::endl
 			  << "Wait times for each job (ordered by job ID):" << std::endl;
 			  
@@ -237,7 +326,135 @@ int main()
 		std::cout << std::dec << programs[i].completion_time << ", ";
 	}
 	std::cout << std::endl << std::endl
-			  << "Percentage of RAM space used (maximum): " << max_ram_usage << std::endl;
+			  << "Percentage of RAM space used (maximum): " << simulator.MaxRamUsage() << std::endl;
+	
+	float turnaround = 0;
+	
+	for (int i = 0; i < programs.size(); i++)
+	{
+		int finish_time = programs[i].finish_time >= 0 ? programs[i].finish_time : metrics::time;
+		turnaround += finish_time - programs[i].arrival_time;
+	}
+	
+	std::cout << "Mean turnaround time: " << turnaround / programs.size() << std::endl;
+	
+	run_queues.PrintStatistics();
+	
+	write_back.PrintStatistics();
+	
+	if (options::resident_limit > 0)
+	{
+		std::cout << std::dec << "Pages evicted: " << simulator.Evictions() << " (" << simulator.CleanEvictions() << " clean, not written back)" << std::endl;
+	}
+	
+	if (options::swap_budget > 0)
+	{
+		swap.PrintStatistics();
+	}
+	
+	if (!options::memory_groups.empty())
+	{
+		groups.PrintStatistics(programs, metrics::time);
+	}
+	
+	if (options::disk_model != "")
+	{
+		disk_device.PrintStatistics();
+	}
+	
+	channels.PrintStatistics();
+	
+	if (options::cache_model)
+	{
+		std::cout << std::endl << "Memory hierarchy per job (ordered by job ID):" << std::endl
+				  << "job, L1I hit %, L1D hit %, L2 hit %, cycles, CPI" << std::endl;
+		
+		unsigned long instructions = 0;
+		
+		for (int i = 0; i < programs.size(); i++)
+		{
+			PCB& job = programs[i];
+			std::cout << std::dec << job.id;
+			
+			for (int level = PCB::L1I; level <= PCB::L2; level++)
+			{
+				unsigned long accesses = job.cache_hits[level] + job.cache_misses[level];
+				std::cout << ", " << (accesses > 0 ? 100.0 * job.cache_hits[level] / accesses : 0);
+			}
+			
+			std::cout << ", " << job.cycles << ", " << (job.instructions > 0 ? job.cycles / (double)job.instructions : 0) << std::endl;
+			
+			instructions += job.instructions;
+		}
+		
+		// the busiest CPU bounds the batch
+		unsigned long makespan = 0;
+		
+		for (int i = 0; i < c; i++)
+		{
+			if (simulator.CpuCycles(i) > makespan)
+			{
+				makespan = simulator.CpuCycles(i);
+			}
+		}
+		
+		std::cout << "Busiest CPU cycles: " << makespan << ", instructions per cycle across CPUs: " << (makespan > 0 ? instructions / (double)makespan : 0) << std::endl;
+	}
+	
+	if (options::pipeline_model)
+	{
+		std::cout << std::endl << "Pipeline per job (ordered by job ID):" << std::endl
+				  << "job, cycles, CPI, hazard stall cycles, branches, mispredicted %" << std::endl;
+		
+		unsigned long instructions = 0;
+		unsigned long cycles = 0;
+		unsigned long branches = 0;
+		unsigned long mispredictions = 0;
+		
+		for (int i = 0; i < programs.size(); i++)
+		{
+			PCB& job = programs[i];
+			
+			std::cout << std::dec << job.id << ", " << job.pipeline_cycles << ", " << (job.instructions > 0 ? job.pipeline_cycles / (double)job.instructions : 0)
+					  << ", " << job.hazard_stalls << ", " << job.branches << ", " << (job.branches > 0 ? 100.0 * job.mispredictions / job.branches : 0) << std::endl;
+			
+			instructions += job.instructions;
+			cycles += job.pipeline_cycles;
+			branches += job.branches;
+			mispredictions += job.mispredictions;
+		}
+		
+		std::cout << "Overall CPI: " << (instructions > 0 ? cycles / (double)instructions : 0)
+				  << ", branches mispredicted: " << (branches > 0 ? 100.0 * mispredictions / branches : 0) << "%" << std::endl;
+	}
+	
+	if (options::print_results)
+	{
+		PrintResults();
+	}
+	
+	if (options::profile_path != "")
+	{
+		profiles.Save(options::profile_path);
+	}
+	
+	if (memoize)
+	{
+		results.PrintStatistics();
+		results.Save(options::result_cache);
+	}
+	
+	if (options::guest_profile != "")
+	{
+		guest_profiler::Write(disk, programs, options::guest_profile);
+	}
+	
+	if (options::host_counters)
+	{
+		host_counters::Enter(host_counters::NONE);
+		host_counters::PrintStatistics();
+		host_counters::Close();
+	}
 	
 	// mmu.PrintFrames(&programs[3]);
 /*
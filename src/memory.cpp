@@ -2,16 +2,80 @@
 #include "types.h"
 #include <assert.h>
 #include <iostream>
+#include <iomanip>
+#include <stdint.h>
+
+#if defined(__unix__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
 
 Memory::Memory(size_t size)
 {
-	data_ = new types::Byte[size];
 	size_ = size;
+	
+	// round the arena up to whole huge pages so it can be backed by transparent huge pages
+	arena_size_ = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+	arena_ = NULL;
+	mapped_ = false;
+	frames_fd_ = -1;
+	
+#if defined(__unix__)
+	// over-reserve by one huge page so the arena can start on a huge page boundary
+	size_t reserve_size = arena_size_ + HUGE_PAGE_SIZE;
+	void* reservation = mmap(NULL, reserve_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	
+	if (reservation != MAP_FAILED)
+	{
+		uintptr_t start = (uintptr_t)reservation;
+		uintptr_t aligned = (start + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+		
+		// give back the unaligned head and the tail
+		if (aligned > start)
+		{
+			munmap(reservation, aligned - start);
+		}
+		
+		if (start + reserve_size > aligned + arena_size_)
+		{
+			munmap((void*)(aligned + arena_size_), start + reserve_size - (aligned + arena_size_));
+		}
+		
+		arena_ = (void*)aligned;
+		mapped_ = true;
+		
+#if defined(MADV_HUGEPAGE)
+		madvise(arena_, arena_size_, MADV_HUGEPAGE); // only a hint, ignore failure
+#endif
+	}
+#endif
+	
+	if (!mapped_)
+	{
+		arena_ = new types::Word[arena_size_ / sizeof(types::Word)](); // zeroed like an anonymous mapping
+	}
+	
+	words_ = (types::Word*)arena_;
 }
 
 Memory::~Memory()
 {
-	delete[] data_;
+#if defined(__unix__)
+	if (frames_fd_ != -1)
+	{
+		close(frames_fd_);
+	}
+	
+	if (mapped_)
+	{
+		munmap(arena_, arena_size_);
+		return;
+	}
+#endif
+	
+	delete[] (types::Word*)arena_;
 }
 
 unsigned int Memory::GetSize()
@@ -19,13 +83,61 @@ unsigned int Memory::GetSize()
 	return size_;
 }
 
+int Memory::ShareFrames(size_t num_frames, size_t frame_stride)
+{
+#if defined(__linux__)
+	size_t shared_size = num_frames * frame_stride;
+	
+	int fd = memfd_create("vm-ram", 0);
+	
+	if (fd == -1 || ftruncate(fd, shared_size) != 0)
+	{
+		return -1;
+	}
+	
+	void* shared = mmap(NULL, shared_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	
+	if (shared == MAP_FAILED)
+	{
+		close(fd);
+		return -1;
+	}
+	
+	// drop the private arena
+	if (mapped_)
+	{
+		munmap(arena_, arena_size_);
+	}
+	else
+	{
+		delete[] (types::Word*)arena_;
+	}
+	
+	arena_ = shared;
+	arena_size_ = shared_size;
+	mapped_ = true;
+	frames_fd_ = fd;
+	
+	size_ = shared_size;
+	words_ = (types::Word*)arena_;
+	
+	return fd;
+#else
+	return -1;
+#endif
+}
+
 //**DEBUG FUNCTIONS**//
 void Memory::PrintBlockPerByte(unsigned int base_address, unsigned int block_size)
 {
 	
 	for (unsigned int i = base_address; i < base_address + block_size; i++) 
 	{
-		std::cout << std::hex << "[" << (int)data_[i] << "], ";
+		// bytes are shown in guest (big-endian) order
+		types::Word word = words_[i / sizeof(types::Word)];
+		int byte = (word >> (8 * (sizeof(types::Word) - 1 - i % sizeof(types::Word)))) & 0xFF;
+		
+		std::cout << std::hex << "[" << byte << "], ";
 	}
 		
 	std::cout << std::endl;
@@ -36,22 +148,8 @@ void Memory::PrintBlockPerWord(unsigned int base_address, unsigned int block_siz
 	
 	for (unsigned int i = base_address; i < base_address + block_size; i += sizeof(types::Word)) 
 	{
-		std::cout << "[";
-		
-		for (int j = 0; j < sizeof(types::Word); j++)
-		{
-			if (data_[i + j] > 0xF)
-			{
-				std::cout << std::hex << (int)data_[i + j];
-			}
-			else
-			{
-				std::cout << std::hex << "0" << (int)data_[i + j];
-			}
-		}
-		
-		std::cout << "], " << std::endl;
+		std::cout << "[" << std::hex << std::setw(8) << std::setfill('0') << words_[i / sizeof(types::Word)] << std::setfill(' ') << "], " << std::endl;
 	}
 		
 	std::cout << std::endl;
-}
\ No newline at end of file
+}
@@ -7,26 +7,37 @@
 class Memory
 {
 private:
-	// memory contents
-	types::Byte* data_;
-	size_t size_;
+	// memory contents. guest words are kept host-native and word aligned,
+	// endianness is only converted when moving words to and from the Disk
+	types::Word* words_;
+	size_t size_; // in bytes
+	
+	// backing arena
+	void* arena_;
+	size_t arena_size_;
+	bool mapped_; // arena came from mmap rather than the heap
+	int frames_fd_; // shared memory file backing the arena, -1 when private
 	
 public:
 	Memory(size_t size);
 	~Memory();
 
-	// reads memory and stores it in the buffer
-	// needs the base address, pointer to the buffer, and number of bytes to be read ( must not exceed sizeof(buffer) )
-	template<typename T>
-	void Read(unsigned int base_address, T* buffer, size_t size);
+	// reads the word at a word aligned absolute byte address
+	types::Word LoadWord(unsigned int address);
+	
+	// writes the word at a word aligned absolute byte address
+	void StoreWord(unsigned int address, types::Word word);
 	
-	// writes memory at the specified base address with the data given in the buffer
-	// needs the base address, pointer to the buffer, and number of bytes to be written ( must not exceed sizeof(buffer) )
-	template<typename T>
-	void Write(unsigned int base_address, T* buffer, size_t size);
+	// the word at a word aligned absolute byte address, the rest of its frame follows it
+	types::Word* WordPointer(unsigned int address);
 	
 	unsigned int GetSize();
 	
+	// rebuilds the arena as a shared memory file with every frame on its own host page,
+	// so frames can be mapped into host address spaces. must be called before anything
+	// is loaded. returns the file descriptor, -1 when unsupported
+	int ShareFrames(size_t num_frames, size_t frame_stride);
+	
 	/**DEBUG FUNCTIONS**/
 	// print the contents of a memory block given a base address and size of block
 	void PrintBlockPerByte(unsigned int base_address, unsigned int block_size);
@@ -35,4 +46,4 @@ public:
 
 #include "memory.template"
 
-#endif // MEMORY_H
\ No newline at end of file
+#endif // MEMORY_H
@@ -0,0 +1,197 @@
+#include "memory_groups.h"
+#include <algorithm>
+#include <iostream>
+#include "machine_config.h"
+
+MemoryGroups::MemoryGroups(MemManager& mmu)
+	: mmu_(mmu)
+{
+	Group group;
+	group.config.name = "default";
+	group.config.quota = 0;
+	group.config.reservation = 0;
+	group.config.priority = 0;
+	group.held = 0;
+	group.peak_held = 0;
+	group.held_time = 0;
+	group.last_change = 0;
+	group.evictions = 0;
+	
+	groups_.push_back(group);
+}
+
+bool MemoryGroups::Configure(const std::vector<MemoryGroupConfig>& configs, std::vector<PCB>& jobs)
+{
+	unsigned int reserved = 0;
+	
+	for (int i = 0; i < configs.size(); i++)
+	{
+		const MemoryGroupConfig& config = configs[i];
+		
+		if (config.quota > 0 && config.reservation > config.quota)
+		{
+			std::cout << "Group " << config.name << " reserves more frames than its quota" << std::endl;
+			return false;
+		}
+		
+		reserved += config.reservation;
+		
+		Group group = groups_[0];
+		group.config = config;
+		groups_.push_back(group);
+	}
+	
+	if (reserved > mmu_.GetNumFrames())
+	{
+		std::cout << "Groups reserve " << reserved << " frames, memory has " << mmu_.GetNumFrames() << std::endl;
+		return false;
+	}
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		PCB& job = jobs[i];
+		job.memory_group = 0;
+		
+		for (int j = 1; j < groups_.size(); j++)
+		{
+			if (groups_[j].config.jobs.count(job.id) == 0)
+			{
+				continue;
+			}
+			
+			if (job.memory_group != 0)
+			{
+				std::cout << "Job " << job.id << " is in groups " << groups_[job.memory_group].config.name << " and " << groups_[j].config.name << std::endl;
+				return false;
+			}
+			
+			job.memory_group = j;
+		}
+		
+		unsigned int quota = groups_[job.memory_group].config.quota;
+		
+		if (quota > 0 && quota < job.min_frames)
+		{
+			std::cout << "Group " << groups_[job.memory_group].config.name << " quota is below the " << job.min_frames << " frames job " << job.id << " needs" << std::endl;
+			return false;
+		}
+		
+		// a verified job keeps its whole image resident, a quota smaller than that pages it instead
+		if (quota > 0 && job.verified && Machine::PagesFor(job.program_size) > quota)
+		{
+			job.verified = false;
+		}
+	}
+	
+	return true;
+}
+
+unsigned int MemoryGroups::Count()
+{
+	return groups_.size();
+}
+
+unsigned int MemoryGroups::Quota(PCB* process)
+{
+	return groups_[process->memory_group].config.quota;
+}
+
+int MemoryGroups::Priority(PCB* process)
+{
+	return groups_[process->memory_group].config.priority;
+}
+
+void MemoryGroups::Account(Group& group, int now)
+{
+	group.held_time += (unsigned long)group.held * (now - group.last_change);
+	group.last_change = now;
+}
+
+bool MemoryGroups::Reserve(PCB* process, unsigned int count, int now)
+{
+	Group& group = groups_[process->memory_group];
+	
+	if (group.config.quota > 0 && group.held + count > group.config.quota)
+	{
+		return false;
+	}
+	
+	// what the other groups have reserved and not used yet stays free for them
+	unsigned int kept = 0;
+	
+	for (int i = 0; i < groups_.size(); i++)
+	{
+		if (&groups_[i] != &group && groups_[i].held < groups_[i].config.reservation)
+		{
+			kept += groups_[i].config.reservation - groups_[i].held;
+		}
+	}
+	
+	if (mmu_.GetReservedFrames() + kept + count > mmu_.GetNumFrames() || !mmu_.ReserveFrames(count))
+	{
+		return false;
+	}
+	
+	Account(group, now);
+	group.held += count;
+	group.peak_held = std::max(group.peak_held, group.held);
+	
+	return true;
+}
+
+void MemoryGroups::Unreserve(PCB* process, unsigned int count, int now)
+{
+	Group& group = groups_[process->memory_group];
+	
+	Account(group, now);
+	group.held -= count;
+	
+	mmu_.UnreserveFrames(count);
+}
+
+void MemoryGroups::CountEviction(PCB* process)
+{
+	groups_[process->memory_group].evictions++;
+}
+
+void MemoryGroups::PrintStatistics(std::vector<PCB>& jobs, int end_time)
+{
+	std::cout << std::endl << "Memory groups:" << std::endl
+			  << "group, jobs, quota, reservation, priority, peak frames, mean frames, page faults, evictions, mean turnaround, max turnaround" << std::endl;
+	
+	for (int i = 0; i < groups_.size(); i++)
+	{
+		Group& group = groups_[i];
+		Account(group, end_time);
+		
+		unsigned int num_jobs = 0;
+		unsigned long page_faults = 0;
+		long turnaround = 0;
+		int max_turnaround = 0;
+		
+		for (int j = 0; j < jobs.size(); j++)
+		{
+			if (jobs[j].memory_group != i)
+			{
+				continue;
+			}
+			
+			int finish_time = jobs[j].finish_time >= 0 ? jobs[j].finish_time : end_time;
+			
+			num_jobs++;
+			page_faults += jobs[j].page_faults;
+			turnaround += finish_time - jobs[j].arrival_time;
+			max_turnaround = std::max(max_turnaround, finish_time - jobs[j].arrival_time);
+		}
+		
+		// the default group is left out when every job is in a named one
+		if (i == 0 && num_jobs == 0)
+		{
+			continue;
+		}
+		
+		std::cout << std::dec << group.config.name << ", " << num_jobs << ", " << group.config.quota << ", " << group.config.reservation << ", " << group.config.priority
+				  << ", " << group.peak_held << ", " << (end_time > 0 ? group.held_time / (double)end_time : 0) << ", " << page_faults << ", " << group.evictions
+				  << ", " << (num_jobs > 0 ? turnaround / (double)num_jobs : 0) << ", " << max_turnaround << std::endl;
+	}
+}
@@ -0,0 +1,65 @@
+#ifndef MEMORY_GROUPS_H
+#define MEMORY_GROUPS_H
+
+#include <set>
+#include <string>
+#include <vector>
+#include "memory_manager.h"
+#include "pcb.h"
+
+struct MemoryGroupConfig
+{
+	std::string name;
+	std::set<unsigned int> jobs; // ids
+	unsigned int quota; // frames its processes may hold between them, 0 for no limit
+	unsigned int reservation; // frames kept free for it while it holds fewer
+	int priority; // higher is admitted first
+};
+
+// named groups of jobs sharing the frame pool. a group's processes are only admitted while
+// the frames promised to them fit in its quota, and a process larger than the quota pages
+// within it. frames another group has reserved and is not using are off limits, so a small
+// group always has room for its next job however much the others want. jobs in no group are
+// in the default group, which has no quota, reservation or priority
+class MemoryGroups
+{
+private:
+	struct Group
+	{
+		MemoryGroupConfig config;
+		unsigned int held; // frames promised to its admitted processes
+		
+		// statistics
+		unsigned int peak_held;
+		unsigned long held_time; // frames held times ticks, for the mean
+		int last_change; // when held last changed
+		unsigned long evictions;
+	};
+	
+	MemManager& mmu_;
+	std::vector<Group> groups_; // the default group first
+	
+	void Account(Group& group, int now);
+
+public:
+	MemoryGroups(MemManager& mmu);
+	
+	// puts the jobs in their groups. returns false if a group cannot hold one of its jobs
+	bool Configure(const std::vector<MemoryGroupConfig>& configs, std::vector<PCB>& jobs);
+	
+	unsigned int Count();
+	unsigned int Quota(PCB* process); // 0 for no limit
+	int Priority(PCB* process);
+	
+	// promises frames to a process out of its group's quota and the frames no other group has
+	// reserved. returns false if they are not available
+	bool Reserve(PCB* process, unsigned int count, int now);
+	void Unreserve(PCB* process, unsigned int count, int now);
+	
+	void CountEviction(PCB* process);
+	
+	// occupancy, faults and turnaround of each group over a run that ended at end_time
+	void PrintStatistics(std::vector<PCB>& jobs, int end_time);
+};
+
+#endif // MEMORY_GROUPS_H
@@ -2,13 +2,21 @@
 #include <algorithm>
 #include <iostream>
 #include <math.h>
+#include "address_space.h"
 
-MemManager::MemManager(Memory* memory, unsigned int frame_size)
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+MemManager::MemManager(Memory* memory)
 {
 	memory_ = memory;
-	frame_size_ = frame_size;
+	frame_stride_shift_ = Machine::FRAME_SHIFT;
+	frames_fd_ = -1;
+	caches_ = NULL;
+	reserved_frames_ = 0;
 	
-	num_frames_ = memory_->GetSize() / frame_size_;
+	num_frames_ = memory_->GetSize() >> Machine::FRAME_SHIFT;
 }
 
 MemManager::~MemManager()
@@ -22,7 +30,7 @@ Memory* MemManager::GetMemory()
 
 unsigned int MemManager::GetFrameSize()
 {
-	return frame_size_;
+	return Machine::FRAME_SIZE;
 }
 
 unsigned int MemManager::GetNumFrames()
@@ -30,32 +38,51 @@ unsigned int MemManager::GetNumFrames()
 	return num_frames_;
 }
 
-uint32_t MemManager::GetEffectiveAddress(uint32_t logical_address, uint32_t* page_table)
+unsigned int MemManager::GetReservedFrames()
+{
+	return reserved_frames_;
+}
+
+uint32_t MemManager::GetFrameAddress(uint32_t frame_index)
 {
-	return page_table[logical_address / frame_size_] == 0xFFFFFFFF ? 0xFFFFFFFF : page_table[logical_address / frame_size_] * frame_size_ + (logical_address % frame_size_);
+	return frame_index << frame_stride_shift_;
+}
+
+uint32_t MemManager::GetEffectiveAddress(uint32_t logical_address, const PCB::PageTable& page_table)
+{
+	uint32_t frame_index = page_table[Machine::PageOf(logical_address)];
+	
+	return frame_index == 0xFFFFFFFF ? 0xFFFFFFFF : (frame_index << frame_stride_shift_) | Machine::OffsetOf(logical_address);
 }
 
 uint32_t MemManager::FetchWord(uint32_t absolute_address)
 {
-	uint32_t buff;
-	memory_->Read(absolute_address, &buff, sizeof(buff));
-	return buff;
+	return memory_->LoadWord(absolute_address);
+}
+
+void MemManager::StoreWord(uint32_t absolute_address, uint32_t word)
+{
+	memory_->StoreWord(absolute_address, word);
 }
 
-uint32_t* MemManager::Allocate(unsigned int num_bytes)
+types::Word* MemManager::WordPointer(uint32_t absolute_address)
 {
-	int frames_to_allocate = ceil(num_bytes / (float)frame_size_);
+	return memory_->WordPointer(absolute_address);
+}
+
+void MemManager::Allocate(unsigned int num_bytes, PCB::PageTable& frames)
+{
+	int frames_to_allocate = Machine::PagesFor(num_bytes);
 	//std::cout << std::dec << num_bytes << std::endl;
-	uint32_t* frames = new unsigned int[frames_to_allocate];
 	
 	unsigned int index = 0;
 	unsigned int frames_allocated = 0;
 	
-	while (index <= num_frames_ && frames_allocated < frames_to_allocate)
+	while (index < num_frames_ && frames_allocated < frames_to_allocate)
 	{
 		if (std::find(used_frame_indexes_.begin(), used_frame_indexes_.end(), index) == used_frame_indexes_.end()) // is the current frame unoccupied?
 		{
-			frames[frames_allocated] = index;
+			frames.Set(frames_allocated, index);
 			used_frame_indexes_.push_back(index);
 			
 			frames_allocated++;
@@ -64,19 +91,17 @@ uint32_t* MemManager::Allocate(unsigned int num_bytes)
 		index++;
 	}
 	
-	if (index > num_frames_)
+	if (frames_allocated < frames_to_allocate)
 	{
 		std::cout << "Cannot allocate memory" << std::endl;
 	}
-
-	return frames;
 }
 
 uint32_t MemManager::AllocateFrame() // allocate one frame
 {
 	int index = 0;
 	
-	while (index <= num_frames_)
+	while (index < num_frames_)
 	{
 		if (std::find(used_frame_indexes_.begin(), used_frame_indexes_.end(), index) == used_frame_indexes_.end()) // is the current frame unoccupied?
 		{
@@ -88,31 +113,162 @@ uint32_t MemManager::AllocateFrame() // allocate one frame
 	}
 
 	std::cout << "Cannot allocate memory" << std::endl;
+	
+	return 0xFFFFFFFF;
+}
 
+bool MemManager::ReserveFrames(unsigned int count)
+{
+	if (reserved_frames_ + count > num_frames_)
+	{
+		return false;
+	}
+	
+	reserved_frames_ += count;
+	return true;
 }
 
-void MemManager::Release(uint32_t* page_table, size_t size)
+void MemManager::UnreserveFrames(unsigned int count)
 {
-	for (int i = 0; i < size; i++)
+	reserved_frames_ -= count;
+}
+
+void MemManager::Release(PCB::PageTable& page_table)
+{
+	page_table.ForEachMapped([this](uint32_t page, uint32_t frame_index)
+	{
+		used_frame_indexes_.erase(std::remove(used_frame_indexes_.begin(), used_frame_indexes_.end(), frame_index), used_frame_indexes_.end());
+	});
+	
+	page_table.Clear();
+}
+
+void MemManager::SetCacheHierarchy(CacheHierarchy* caches)
+{
+	caches_ = caches;
+}
+
+CacheHierarchy* MemManager::GetCacheHierarchy()
+{
+	return caches_;
+}
+
+void MemManager::MapPage(PCB* process, uint32_t page_num, uint32_t frame_index)
+{
+	process->page_table.Set(page_num, frame_index);
+	
+	if (caches_ != NULL)
 	{
-		used_frame_indexes_.erase(std::remove(used_frame_indexes_.begin(), used_frame_indexes_.end(), page_table[i]), used_frame_indexes_.end());
+		caches_->InvalidateRange(frame_index << Machine::FRAME_SHIFT, Machine::FRAME_SIZE);
+	}
+	
+	if (process->address_space != NULL && page_num < AddressSpace::GUEST_PAGES)
+	{
+		process->address_space->Map(page_num, frame_index);
 	}
 }
 
-void MemManager::PrintFrames(PCB* process)
+void MemManager::UnmapPage(PCB* process, uint32_t page_num)
+{
+	uint32_t frame_index = process->page_table[page_num];
+	
+	used_frame_indexes_.erase(std::remove(used_frame_indexes_.begin(), used_frame_indexes_.end(), frame_index), used_frame_indexes_.end());
+	process->page_table.Set(page_num, PageTable::INVALID);
+	
+	if (caches_ != NULL)
+	{
+		caches_->InvalidateRange(frame_index << Machine::FRAME_SHIFT, Machine::FRAME_SIZE);
+	}
+	
+	if (process->address_space != NULL && page_num < AddressSpace::GUEST_PAGES)
+	{
+		process->address_space->Unmap(page_num);
+	}
+}
+
+bool MemManager::EnableHostMapping()
+{
+#if defined(__unix__)
+	if (!AddressSpace::Supported())
+	{
+		return false;
+	}
+	
+	unsigned int page_size = sysconf(_SC_PAGESIZE);
+	
+	frames_fd_ = memory_->ShareFrames(num_frames_, page_size);
+	
+	if (frames_fd_ == -1 || !AddressSpace::InstallFaultHandler())
+	{
+		return false;
+	}
+	
+	frame_stride_shift_ = Machine::Log2(page_size);
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool MemManager::HostMappingEnabled()
+{
+	return frames_fd_ != -1;
+}
+
+void MemManager::CreateAddressSpace(PCB* process)
+{
+	process->address_space = new AddressSpace(frames_fd_, frame_stride_shift_);
+	
+	// map whatever is already resident inside the 16 bit window
+	process->page_table.ForEachMapped([process](uint32_t page, uint32_t frame_index)
+	{
+		if (page < AddressSpace::GUEST_PAGES)
+		{
+			process->address_space->Map(page, frame_index);
+		}
+	});
+}
+
+void MemManager::DestroyAddressSpace(PCB* process)
+{
+	delete process->address_space;
+	process->address_space = NULL;
+}
+
+void MemManager::PrintFrames(PCB* process, Disk& disk)
 {
 	std::cout << "Program " << process->id << " frames: " << std::endl;
 	
-	for (int frame = 0; frame < ceil(process->program_size / (float)frame_size_); frame++)
+	for (int frame = 0; frame < Machine::PagesFor(process->program_size); frame++)
 	{
 		std::cout << "Frame " << frame << ": " << std::endl;
 		
-		uint32_t frame_base_addr = process->page_table[frame] * frame_size_;
+		if (process->page_table[frame] == 0xFFFFFFFF && process->paged_out[frame])
+		{
+			uint32_t disk_address = process->disk_address + (frame << Machine::FRAME_SHIFT);
+			
+			for (uint32_t offset = 0; offset < Machine::FRAME_SIZE; offset += sizeof(types::Word))
+			{
+				types::Word buff;
+				disk.Read(disk_address + offset, &buff, sizeof(buff));
+				std::cout << std::hex << "[" << (int)buff << "], " << std::endl;
+			}
+			
+			std::cout << std::endl << std::endl;
+			continue;
+		}
+		
+		if (process->page_table[frame] == 0xFFFFFFFF) // never loaded
+		{
+			std::cout << std::endl << std::endl;
+			continue;
+		}
+		
+		uint32_t frame_base_addr = GetFrameAddress(process->page_table[frame]);
 		
-		for (uint32_t byte_addr = frame_base_addr; byte_addr < (frame_base_addr + frame_size_); byte_addr += 4)
+		for (uint32_t byte_addr = frame_base_addr; byte_addr < (frame_base_addr + Machine::FRAME_SIZE); byte_addr += sizeof(types::Word))
 		{
-			types::Word buff;
-			GetMemory()->Read(byte_addr, &buff, sizeof(buff));
+			types::Word buff = memory_->LoadWord(byte_addr);
 			std::cout << std::hex << "[" << (int)buff << "], " << std::endl;
 		}
 		
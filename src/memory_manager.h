@@ -3,6 +3,8 @@
 
 #include "memory.h"
 #include "pcb.h"
+#include "cache.h"
+#include "disk.h"
 #include <vector>
 
 class MemManager
@@ -11,31 +13,64 @@ private:
 	Memory* memory_;
 	std::vector<unsigned int> used_frame_indexes_;
 	
-	unsigned int frame_size_;
+	unsigned int frame_stride_shift_; // log2 distance between frames in memory, the frame size unless host mapped
 	unsigned int num_frames_;
+	unsigned int reserved_frames_; // promised to admitted processes
+	
+	int frames_fd_; // shared RAM file when host mapping is enabled, -1 otherwise
+	
+	CacheHierarchy* caches_; // optional timing model, NULL when off
 	
 public:
-	MemManager(Memory* memory, unsigned int frame_size);
+	MemManager(Memory* memory); // frames are Machine::FRAME_SIZE bytes
 	~MemManager();
 	
 	Memory* GetMemory();
 	unsigned int GetFrameSize();
 	unsigned int GetNumFrames();
-	uint32_t GetEffectiveAddress(uint32_t logical_address, uint32_t* page_table);
+	unsigned int GetReservedFrames();
+	uint32_t GetFrameAddress(uint32_t frame_index); // absolute address of a frame
+	uint32_t GetEffectiveAddress(uint32_t logical_address, const PCB::PageTable& page_table);
 	uint32_t FetchWord(uint32_t absolute_address);
+	void StoreWord(uint32_t absolute_address, uint32_t word);
+	types::Word* WordPointer(uint32_t absolute_address); // for the block instructions, valid to the end of the frame
 	
-	// returns table of unused frame indexes
+	// fills the page table with unused frame indexes
 	// finds first available
-	uint32_t* Allocate(unsigned int num_bytes);
+	void Allocate(unsigned int num_bytes, PCB::PageTable& page_table);
 	
-	// returns single empty frame index and adds it to list of used frames
+	// returns single empty frame index and adds it to list of used frames, 0xFFFFFFFF if memory is full
 	uint32_t AllocateFrame();
 	
-	// releases the given page table's frames
-	void Release(uint32_t* page_table, size_t size);
+	// admission control. a process is only admitted once frames for its whole image are promised
+	// to it, so demand paging can never run out of memory. returns false if they are not available
+	bool ReserveFrames(unsigned int count);
+	void UnreserveFrames(unsigned int count);
+	
+	// releases every frame the page table maps and frees the table
+	void Release(PCB::PageTable& page_table);
+	
+	// attaches a cache timing model. frames loaded from disk are invalidated in it
+	void SetCacheHierarchy(CacheHierarchy* caches);
+	CacheHierarchy* GetCacheHierarchy();
+	
+	// points a process' page at a frame
+	void MapPage(PCB* process, uint32_t page_num, uint32_t frame_index);
+	
+	// takes a resident page away from a process and frees its frame
+	void UnmapPage(PCB* process, uint32_t page_num);
+	
+	// moves RAM into host mappable frames so processes can run in host address spaces.
+	// must be called before anything is loaded
+	bool EnableHostMapping();
+	bool HostMappingEnabled();
+	
+	// gives a process a host address space. its resident pages are mapped into it from then on
+	void CreateAddressSpace(PCB* process);
+	void DestroyAddressSpace(PCB* process);
 	
-	// prints out all frames used by a profess
-	void PrintFrames(PCB* process);
+	// prints out all frames used by a profess. pages that were paged out are read from the disk image
+	void PrintFrames(PCB* process, Disk& disk);
 	
 	float PercentageUsed();
 };
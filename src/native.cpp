@@ -0,0 +1,19 @@
+#include "native.h"
+
+namespace native
+{
+
+JobFunction Find(uint64_t content_hash)
+{
+	for (const Translation* translation = LIBRARY; translation->run != NULL; translation++)
+	{
+		if (translation->content_hash == content_hash)
+		{
+			return translation->run;
+		}
+	}
+	
+	return NULL;
+}
+
+}
@@ -0,0 +1,44 @@
+#ifndef NATIVE_H
+#define NATIVE_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct PCB;
+class MemManager;
+
+// jobs translated ahead of time into C++ by translator::Translate and built into the VM as the
+// precompiled job library, native_jobs.cpp. a job runs its translation when the hash of its
+// image matches, see CPU::RunNative
+namespace native
+{
+// why a translation returned
+enum EXITS {BUDGET, FAULT, HALT, DIVIDE_BY_ZERO, INTERPRET, CODE_WRITTEN};
+
+struct Context
+{
+	PCB* process;
+	MemManager* mmu;
+	unsigned long retired; // instructions retired so far
+	unsigned long ticks; // set on exit, a faulting instruction takes a tick without retiring
+	uint32_t fault_address; // logical address, on FAULT
+};
+
+// runs the process from its program counter for up to budget ticks and returns one of EXITS.
+// the program counter and counters are up to date when it returns
+typedef int (*JobFunction)(Context& context, unsigned long budget);
+
+struct Translation
+{
+	uint64_t content_hash; // of the image it was translated from
+	unsigned int id; // job it was translated from
+	JobFunction run; // NULL ends the library
+};
+
+extern const Translation LIBRARY[];
+
+// the translation of a job's image, NULL if there is none
+JobFunction Find(uint64_t content_hash);
+}
+
+#endif // NATIVE_H
@@ -0,0 +1,5854 @@
+// precompiled job library, generated by vm --translate from the deck. do not edit
+#include "native_runtime.h"
+
+// job 1, 23 code words
+static int Job1(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x5c
+	process.io_ops++;
+	address = 0x005C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x5c
+	r[10] = 0x005C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xdc
+	r[13] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xdc
+	r[9] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // WR r0, r0, 0xac
+	process.io_ops++;
+	address = 0x00AC;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0054, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0058, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // HLT
+	return native::Halt(context, 0x0058);
+}
+
+// job 2, 28 code words
+static int Job2(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		case 0x0060: goto at_0060;
+		case 0x0064: goto at_0064;
+		case 0x0068: goto at_0068;
+		case 0x006C: goto at_006C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x70
+	process.io_ops++;
+	address = 0x0070;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x70
+	r[10] = 0x0070;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xf0
+	r[13] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xf0
+	r[9] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r0, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[0] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // LW r9, r2, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0048, address);
+	}
+	r[2] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // SLT r0, r2, r8
+	r[8] = r[0] < r[2] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // BEQ r8, r1, 0x60
+	if (r[8] == r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0060, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0060))
+		{
+			return native::Fault(context, 0x0060, 0x0060);
+		}
+		goto at_0060;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // MOV r0, r2, r0
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0060, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0060))
+	{
+		return native::Fault(context, 0x0060, 0x0060);
+	}
+	
+at_0060: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0064, native::BUDGET);
+	}
+	
+at_0064: // BNE r8, r1, 0x48
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0048, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0048))
+		{
+			return native::Fault(context, 0x0048, 0x0048);
+		}
+		goto at_0048;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0068, native::BUDGET);
+	}
+	
+at_0068: // WR r0, r0, 0xc0
+	process.io_ops++;
+	address = 0x00C0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0068, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x006C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x006C, native::BUDGET);
+	}
+	
+at_006C: // HLT
+	return native::Halt(context, 0x006C);
+}
+
+// job 3, 24 code words
+static int Job3(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x60
+	process.io_ops++;
+	address = 0x0060;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x60
+	r[10] = 0x0060;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xe0
+	r[13] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xe0
+	r[9] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // DIV r0, r5, r0
+	if (r[5] == 0)
+	{
+		return native::DivideByZero(context, 0x0054);
+	}
+	r[0] = r[0] / r[5];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // WR r0, r0, 0xb0
+	process.io_ops++;
+	address = 0x00B0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0058, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x005C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // HLT
+	return native::Halt(context, 0x005C);
+}
+
+// job 4, 19 code words
+static int Job4(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r2, r3, r0
+	r[2] = r[3];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r3, r0, r0
+	r[3] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+// job 5, 28 code words
+static int Job5(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		case 0x0060: goto at_0060;
+		case 0x0064: goto at_0064;
+		case 0x0068: goto at_0068;
+		case 0x006C: goto at_006C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x70
+	process.io_ops++;
+	address = 0x0070;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x70
+	r[10] = 0x0070;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xf0
+	r[13] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xf0
+	r[9] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r0, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[0] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // LW r9, r2, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0048, address);
+	}
+	r[2] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // SLT r0, r2, r8
+	r[8] = r[0] < r[2] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // BEQ r8, r1, 0x60
+	if (r[8] == r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0060, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0060))
+		{
+			return native::Fault(context, 0x0060, 0x0060);
+		}
+		goto at_0060;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // MOV r0, r2, r0
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0060, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0060))
+	{
+		return native::Fault(context, 0x0060, 0x0060);
+	}
+	
+at_0060: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0064, native::BUDGET);
+	}
+	
+at_0064: // BNE r8, r1, 0x48
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0048, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0048))
+		{
+			return native::Fault(context, 0x0048, 0x0048);
+		}
+		goto at_0048;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0068, native::BUDGET);
+	}
+	
+at_0068: // WR r0, r0, 0xc0
+	process.io_ops++;
+	address = 0x00C0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0068, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x006C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x006C, native::BUDGET);
+	}
+	
+at_006C: // HLT
+	return native::Halt(context, 0x006C);
+}
+
+// job 6, 24 code words
+static int Job6(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x60
+	process.io_ops++;
+	address = 0x0060;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x60
+	r[10] = 0x0060;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xe0
+	r[13] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xe0
+	r[9] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // DIV r0, r5, r0
+	if (r[5] == 0)
+	{
+		return native::DivideByZero(context, 0x0054);
+	}
+	r[0] = r[0] / r[5];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // WR r0, r0, 0xb0
+	process.io_ops++;
+	address = 0x00B0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0058, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x005C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // HLT
+	return native::Halt(context, 0x005C);
+}
+
+// job 7, 19 code words
+static int Job7(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r0, r2, r3
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r0, r0, r2
+	r[0] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+// job 11, 23 code words
+static int Job11(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x5c
+	process.io_ops++;
+	address = 0x005C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x5c
+	r[10] = 0x005C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xdc
+	r[13] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xdc
+	r[9] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // WR r0, r0, 0xac
+	process.io_ops++;
+	address = 0x00AC;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0054, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0058, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // HLT
+	return native::Halt(context, 0x0058);
+}
+
+// job 12, 28 code words
+static int Job12(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		case 0x0060: goto at_0060;
+		case 0x0064: goto at_0064;
+		case 0x0068: goto at_0068;
+		case 0x006C: goto at_006C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x70
+	process.io_ops++;
+	address = 0x0070;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x70
+	r[10] = 0x0070;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xf0
+	r[13] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xf0
+	r[9] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r0, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[0] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // LW r9, r2, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0048, address);
+	}
+	r[2] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // SLT r0, r2, r8
+	r[8] = r[0] < r[2] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // BEQ r8, r1, 0x60
+	if (r[8] == r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0060, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0060))
+		{
+			return native::Fault(context, 0x0060, 0x0060);
+		}
+		goto at_0060;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // MOV r0, r2, r0
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0060, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0060))
+	{
+		return native::Fault(context, 0x0060, 0x0060);
+	}
+	
+at_0060: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0064, native::BUDGET);
+	}
+	
+at_0064: // BNE r8, r1, 0x48
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0048, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0048))
+		{
+			return native::Fault(context, 0x0048, 0x0048);
+		}
+		goto at_0048;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0068, native::BUDGET);
+	}
+	
+at_0068: // WR r0, r0, 0xc0
+	process.io_ops++;
+	address = 0x00C0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0068, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x006C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x006C, native::BUDGET);
+	}
+	
+at_006C: // HLT
+	return native::Halt(context, 0x006C);
+}
+
+// job 14, 19 code words
+static int Job14(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r2, r3, r0
+	r[2] = r[3];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r3, r0, r0
+	r[3] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+// job 15, 24 code words
+static int Job15(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x60
+	process.io_ops++;
+	address = 0x0060;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x60
+	r[10] = 0x0060;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xe0
+	r[13] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xe0
+	r[9] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // DIV r0, r5, r0
+	if (r[5] == 0)
+	{
+		return native::DivideByZero(context, 0x0054);
+	}
+	r[0] = r[0] / r[5];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // WR r0, r0, 0xb0
+	process.io_ops++;
+	address = 0x00B0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0058, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x005C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // HLT
+	return native::Halt(context, 0x005C);
+}
+
+// job 16, 19 code words
+static int Job16(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r2, r3, r0
+	r[2] = r[3];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r3, r0, r0
+	r[3] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+// job 17, 28 code words
+static int Job17(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		case 0x0060: goto at_0060;
+		case 0x0064: goto at_0064;
+		case 0x0068: goto at_0068;
+		case 0x006C: goto at_006C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x70
+	process.io_ops++;
+	address = 0x0070;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x70
+	r[10] = 0x0070;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xf0
+	r[13] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xf0
+	r[9] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r0, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[0] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // LW r9, r2, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0048, address);
+	}
+	r[2] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // SLT r0, r2, r8
+	r[8] = r[0] < r[2] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // BEQ r8, r1, 0x60
+	if (r[8] == r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0060, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0060))
+		{
+			return native::Fault(context, 0x0060, 0x0060);
+		}
+		goto at_0060;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // MOV r0, r2, r0
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0060, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0060))
+	{
+		return native::Fault(context, 0x0060, 0x0060);
+	}
+	
+at_0060: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0064, native::BUDGET);
+	}
+	
+at_0064: // BNE r8, r1, 0x48
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0048, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0048))
+		{
+			return native::Fault(context, 0x0048, 0x0048);
+		}
+		goto at_0048;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0068, native::BUDGET);
+	}
+	
+at_0068: // WR r0, r0, 0xc0
+	process.io_ops++;
+	address = 0x00C0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0068, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x006C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x006C, native::BUDGET);
+	}
+	
+at_006C: // HLT
+	return native::Halt(context, 0x006C);
+}
+
+// job 19, 28 code words
+static int Job19(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		case 0x0060: goto at_0060;
+		case 0x0064: goto at_0064;
+		case 0x0068: goto at_0068;
+		case 0x006C: goto at_006C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x70
+	process.io_ops++;
+	address = 0x0070;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x70
+	r[10] = 0x0070;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xf0
+	r[13] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xf0
+	r[9] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r0, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[0] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // LW r9, r2, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0048, address);
+	}
+	r[2] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // SLT r0, r2, r8
+	r[8] = r[0] < r[2] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // BEQ r8, r1, 0x60
+	if (r[8] == r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0060, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0060))
+		{
+			return native::Fault(context, 0x0060, 0x0060);
+		}
+		goto at_0060;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // MOV r0, r2, r0
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0060, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0060))
+	{
+		return native::Fault(context, 0x0060, 0x0060);
+	}
+	
+at_0060: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0064, native::BUDGET);
+	}
+	
+at_0064: // BNE r8, r1, 0x48
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0048, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0048))
+		{
+			return native::Fault(context, 0x0048, 0x0048);
+		}
+		goto at_0048;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0068, native::BUDGET);
+	}
+	
+at_0068: // WR r0, r0, 0xc0
+	process.io_ops++;
+	address = 0x00C0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0068, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x006C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x006C, native::BUDGET);
+	}
+	
+at_006C: // HLT
+	return native::Halt(context, 0x006C);
+}
+
+// job 21, 19 code words
+static int Job21(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r2, r3, r0
+	r[2] = r[3];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r3, r0, r0
+	r[3] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+// job 23, 23 code words
+static int Job23(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x5c
+	process.io_ops++;
+	address = 0x005C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x5c
+	r[10] = 0x005C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xdc
+	r[13] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xdc
+	r[9] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // WR r0, r0, 0xac
+	process.io_ops++;
+	address = 0x00AC;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0054, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0058, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // HLT
+	return native::Halt(context, 0x0058);
+}
+
+// job 25, 23 code words
+static int Job25(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x5c
+	process.io_ops++;
+	address = 0x005C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x5c
+	r[10] = 0x005C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xdc
+	r[13] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xdc
+	r[9] = 0x00DC;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // WR r0, r0, 0xac
+	process.io_ops++;
+	address = 0x00AC;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0054, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0058, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // HLT
+	return native::Halt(context, 0x0058);
+}
+
+// job 26, 19 code words
+static int Job26(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r2, r3, r0
+	r[2] = r[3];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r3, r0, r0
+	r[3] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+// job 28, 28 code words
+static int Job28(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		case 0x0060: goto at_0060;
+		case 0x0064: goto at_0064;
+		case 0x0068: goto at_0068;
+		case 0x006C: goto at_006C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x70
+	process.io_ops++;
+	address = 0x0070;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x70
+	r[10] = 0x0070;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xf0
+	r[13] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xf0
+	r[9] = 0x00F0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r0, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[0] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // LW r9, r2, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0048, address);
+	}
+	r[2] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // SLT r0, r2, r8
+	r[8] = r[0] < r[2] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // BEQ r8, r1, 0x60
+	if (r[8] == r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0060, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0060))
+		{
+			return native::Fault(context, 0x0060, 0x0060);
+		}
+		goto at_0060;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // MOV r0, r2, r0
+	r[0] = r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0060, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0060))
+	{
+		return native::Fault(context, 0x0060, 0x0060);
+	}
+	
+at_0060: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0064, native::BUDGET);
+	}
+	
+at_0064: // BNE r8, r1, 0x48
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0048, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0048))
+		{
+			return native::Fault(context, 0x0048, 0x0048);
+		}
+		goto at_0048;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0068, native::BUDGET);
+	}
+	
+at_0068: // WR r0, r0, 0xc0
+	process.io_ops++;
+	address = 0x00C0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0068, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x006C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x006C, native::BUDGET);
+	}
+	
+at_006C: // HLT
+	return native::Halt(context, 0x006C);
+}
+
+// job 29, 24 code words
+static int Job29(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		case 0x004C: goto at_004C;
+		case 0x0050: goto at_0050;
+		case 0x0054: goto at_0054;
+		case 0x0058: goto at_0058;
+		case 0x005C: goto at_005C;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x60
+	process.io_ops++;
+	address = 0x0060;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // LDI r0, r10, 0x60
+	r[10] = 0x0060;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // LDI r0, r13, 0xe0
+	r[13] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // ADDI r0, r10, 0x4
+	r[10] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // RD r11, r10, 0x0
+	process.io_ops++;
+	address = (uint16_t)r[10];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	r[11] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ST r11, r13, 0x0
+	address = 0x0000 + r[13];
+	if (!native::Store(context, address, r[11]))
+	{
+		return native::Fault(context, 0x0020, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0024, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r13, 0x4
+	r[13] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // BNE r8, r1, 0x18
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0018, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0018))
+		{
+			return native::Fault(context, 0x0018, 0x0018);
+		}
+		goto at_0018;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // LDI r0, r9, 0xe0
+	r[9] = 0x00E0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // LW r9, r7, 0x0
+	address = 0x0000 + r[9];
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x003C, address);
+	}
+	r[7] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // ADD r0, r7, r0
+	r[0] = r[0] + r[7];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // ADDI r0, r9, 0x4
+	r[9] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x004C, native::BUDGET);
+	}
+	
+at_004C: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0050, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0050))
+	{
+		return native::Fault(context, 0x0050, 0x0050);
+	}
+	
+at_0050: // BNE r8, r1, 0x3c
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x003C, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x003C))
+		{
+			return native::Fault(context, 0x003C, 0x003C);
+		}
+		goto at_003C;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0054, native::BUDGET);
+	}
+	
+at_0054: // DIV r0, r5, r0
+	if (r[5] == 0)
+	{
+		return native::DivideByZero(context, 0x0054);
+	}
+	r[0] = r[0] / r[5];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0058, native::BUDGET);
+	}
+	
+at_0058: // WR r0, r0, 0xb0
+	process.io_ops++;
+	address = 0x00B0;
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x0058, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x005C, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x005C, native::BUDGET);
+	}
+	
+at_005C: // HLT
+	return native::Halt(context, 0x005C);
+}
+
+// job 30, 19 code words
+static int Job30(native::Context& context, unsigned long budget)
+{
+	PCB& process = *context.process;
+	types::Word* r = process.registers.data();
+	uint32_t address;
+	types::Word word;
+	
+	if (!native::Resident(context, process.program_counter))
+	{
+		return native::Fault(context, process.program_counter, process.program_counter);
+	}
+	
+	switch (process.program_counter)
+	{
+		case 0x0000: goto at_0000;
+		case 0x0004: goto at_0004;
+		case 0x0008: goto at_0008;
+		case 0x000C: goto at_000C;
+		case 0x0010: goto at_0010;
+		case 0x0014: goto at_0014;
+		case 0x0018: goto at_0018;
+		case 0x001C: goto at_001C;
+		case 0x0020: goto at_0020;
+		case 0x0024: goto at_0024;
+		case 0x0028: goto at_0028;
+		case 0x002C: goto at_002C;
+		case 0x0030: goto at_0030;
+		case 0x0034: goto at_0034;
+		case 0x0038: goto at_0038;
+		case 0x003C: goto at_003C;
+		case 0x0040: goto at_0040;
+		case 0x0044: goto at_0044;
+		case 0x0048: goto at_0048;
+		default: return native::Exit(context, process.program_counter, native::INTERPRET);
+	}
+	
+at_0000: // RD r5, r0, 0x4c
+	process.io_ops++;
+	address = 0x004C;
+	if (!native::Load(context, address, word))
+	{
+		return native::Fault(context, 0x0000, address);
+	}
+	r[5] = word;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0004, native::BUDGET);
+	}
+	
+at_0004: // MOVI r0, r6, 0x0
+	r[6] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0008, native::BUDGET);
+	}
+	
+at_0008: // MOVI r0, r0, 0x0
+	r[0] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x000C, native::BUDGET);
+	}
+	
+at_000C: // MOVI r0, r1, 0x0
+	r[1] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0010, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0010))
+	{
+		return native::Fault(context, 0x0010, 0x0010);
+	}
+	
+at_0010: // MOVI r0, r2, 0x0
+	r[2] = 0x0000;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0014, native::BUDGET);
+	}
+	
+at_0014: // MOVI r0, r3, 0x1
+	r[3] = 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0018, native::BUDGET);
+	}
+	
+at_0018: // LDI r0, r7, 0x9c
+	r[7] = 0x009C;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x001C, native::BUDGET);
+	}
+	
+at_001C: // WR r2, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[2]))
+	{
+		return native::Fault(context, 0x001C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0020, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0020, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0020))
+	{
+		return native::Fault(context, 0x0020, 0x0020);
+	}
+	
+at_0020: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0024, native::BUDGET);
+	}
+	
+at_0024: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0028, native::BUDGET);
+	}
+	
+at_0028: // ADD r3, r2, r0
+	r[0] = r[3] + r[2];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x002C, native::BUDGET);
+	}
+	
+at_002C: // WR r0, r7, 0x0
+	process.io_ops++;
+	address = r[7];
+	if (!native::Store(context, address, r[0]))
+	{
+		return native::Fault(context, 0x002C, address);
+	}
+	if (native::Written(context, address))
+	{
+		native::Retire(context, budget);
+		return native::Exit(context, 0x0030, native::CODE_WRITTEN);
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0030, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0030))
+	{
+		return native::Fault(context, 0x0030, 0x0030);
+	}
+	
+at_0030: // ADDI r0, r7, 0x4
+	r[7] += 0x0004;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0034, native::BUDGET);
+	}
+	
+at_0034: // ADDI r0, r6, 0x1
+	r[6] += 0x0001;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0038, native::BUDGET);
+	}
+	
+at_0038: // MOV r2, r3, r0
+	r[2] = r[3];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x003C, native::BUDGET);
+	}
+	
+at_003C: // MOV r3, r0, r0
+	r[3] = r[0];
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0040, native::BUDGET);
+	}
+	if (!native::Resident(context, 0x0040))
+	{
+		return native::Fault(context, 0x0040, 0x0040);
+	}
+	
+at_0040: // SLT r6, r5, r8
+	r[8] = r[6] < r[5] ? 1 : 0;
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0044, native::BUDGET);
+	}
+	
+at_0044: // BNE r8, r1, 0x28
+	if (r[8] != r[1])
+	{
+		if (native::Retire(context, budget))
+		{
+			return native::Exit(context, 0x0028, native::BUDGET);
+		}
+		if (!native::Resident(context, 0x0028))
+		{
+			return native::Fault(context, 0x0028, 0x0028);
+		}
+		goto at_0028;
+	}
+	if (native::Retire(context, budget))
+	{
+		return native::Exit(context, 0x0048, native::BUDGET);
+	}
+	
+at_0048: // HLT
+	return native::Halt(context, 0x0048);
+}
+
+const native::Translation native::LIBRARY[] =
+{
+	{0xDF304935AB1D3633ull, 1, Job1},
+	{0xC5ED2D0FD2C425EBull, 2, Job2},
+	{0xCA695E71D138E88Cull, 3, Job3},
+	{0x73B8FEA6071C748Aull, 4, Job4},
+	{0xF611B0A65BEDCEFBull, 5, Job5},
+	{0x1C8B261E17438260ull, 6, Job6},
+	{0xA1BD093BFCCCA9BDull, 7, Job7},
+	{0xCCA3DE7CB3465B73ull, 11, Job11},
+	{0x3137CE58B4B3C32Eull, 12, Job12},
+	{0x8E5A502722957C04ull, 14, Job14},
+	{0xBD8AFF54139D58B6ull, 15, Job15},
+	{0xA0D1906D39AF2523ull, 16, Job16},
+	{0x10CF9F0F9FF9A71Full, 17, Job17},
+	{0x8CE5A56DB4BCD0ACull, 19, Job19},
+	{0x364C4A68CBCB073Bull, 21, Job21},
+	{0xD5CA64235E5B47D5ull, 23, Job23},
+	{0x7D178AEBAE9034DFull, 25, Job25},
+	{0x1380E7ACABF2A166ull, 26, Job26},
+	{0x6BE13C3C4A097ACBull, 28, Job28},
+	{0x29169CB3E261D49Cull, 29, Job29},
+	{0xE66855E5795FF0CDull, 30, Job30},
+	{0, 0, NULL}
+};
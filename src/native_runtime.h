@@ -0,0 +1,92 @@
+#ifndef NATIVE_RUNTIME_H
+#define NATIVE_RUNTIME_H
+
+#include "native.h"
+#include "pcb.h"
+#include "memory_manager.h"
+#include "machine_config.h"
+
+// what translated code calls. guest memory goes through the memory manager's page translation
+// like the interpreter's, and a page that is not resident ends the run with FAULT
+namespace native
+{
+inline int Exit(Context& context, uint32_t pc, int reason)
+{
+	PCB& process = *context.process;
+	
+	process.program_counter = pc;
+	process.instructions += context.retired;
+	process.burst_length += context.retired;
+	process.cycles += context.retired;
+	
+	context.ticks = context.retired + (reason == FAULT || reason == DIVIDE_BY_ZERO ? 1 : 0);
+	return reason;
+}
+
+// the instruction at pc took a fault on the logical address
+inline int Fault(Context& context, uint32_t pc, uint32_t logical_address)
+{
+	context.fault_address = logical_address;
+	return Exit(context, pc, FAULT);
+}
+
+inline int DivideByZero(Context& context, uint32_t pc)
+{
+	return Exit(context, pc, DIVIDE_BY_ZERO);
+}
+
+// HLT retires but leaves the program counter on itself
+inline int Halt(Context& context, uint32_t pc)
+{
+	context.retired++;
+	return Exit(context, pc, HALT);
+}
+
+// true once the budget is used up
+inline bool Retire(Context& context, unsigned long budget)
+{
+	return ++context.retired == budget;
+}
+
+// whether the instruction at the logical address can be fetched
+inline bool Resident(Context& context, uint32_t logical_address)
+{
+	return context.process->page_table[Machine::PageOf(logical_address)] != PageTable::INVALID;
+}
+
+inline bool Load(Context& context, uint32_t logical_address, types::Word& word)
+{
+	uint32_t absolute_address = context.mmu->GetEffectiveAddress(logical_address, context.process->page_table);
+	
+	if (absolute_address == 0xFFFFFFFF)
+	{
+		return false;
+	}
+	
+	word = context.mmu->FetchWord(absolute_address);
+	return true;
+}
+
+inline bool Store(Context& context, uint32_t logical_address, types::Word word)
+{
+	uint32_t absolute_address = context.mmu->GetEffectiveAddress(logical_address, context.process->page_table);
+	
+	if (absolute_address == 0xFFFFFFFF)
+	{
+		return false;
+	}
+	
+	context.mmu->StoreWord(absolute_address, word);
+	return true;
+}
+
+// marks the stored page dirty. true if the store hit the code, which the translation no longer matches
+inline bool Written(Context& context, uint32_t logical_address)
+{
+	context.process->MarkDirty(Machine::PageOf(logical_address));
+	
+	return logical_address < context.process->input_buffer_offset;
+}
+}
+
+#endif // NATIVE_RUNTIME_H
@@ -0,0 +1,344 @@
+#include "options.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "utils.h"
+
+namespace options
+{
+	bool host_mapped = false;
+	std::string profile_path = "";
+	std::string result_cache = "";
+	unsigned int migration_threshold = 2;
+	unsigned int quantum = 10;
+	unsigned int resident_limit = 0;
+	std::vector<MemoryGroupConfig> memory_groups;
+	unsigned int swap_budget = 0;
+	bool cache_model = false;
+	CacheConfig l1_cache = {128, 2, 16, 1};
+	CacheConfig l2_cache = {1024, 4, 16, 10};
+	unsigned int memory_latency = 100;
+	bool pipeline_model = false;
+	Pipeline::PREDICTORS branch_predictor = Pipeline::BIMODAL;
+	PipelineConfig pipeline = {10, 64, 3, 12};
+	std::string disk_model = "";
+	DiskDevice::POLICIES io_policy = DiskDevice::FCFS;
+	int io_deadline = 500;
+	bool native = false;
+	std::string translate_path = "";
+	std::string layout_path = "";
+	std::string layout_profile = "";
+	bool verify = false;
+	bool host_counters = false;
+	std::string coordinator_socket = "";
+	unsigned int workers = 0;
+	std::string worker_socket = "";
+	bool lockstep = false;
+	std::string guest_profile = "";
+	std::map<unsigned int, std::string> input_files;
+	std::map<unsigned int, std::string> output_files;
+	bool print_results = false;
+
+// a whole field in decimal, false if it is not a number or does not fit
+static bool ParseNumber(const std::string& text, unsigned int& value)
+{
+	size_t end;
+	unsigned long number;
+	
+	try
+	{
+		number = std::stoul(text, &end);
+	}
+	catch (const std::invalid_argument&)
+	{
+		return false;
+	}
+	catch (const std::out_of_range&)
+	{
+		return false;
+	}
+	
+	value = number;
+	return end == text.size() && number <= 0xFFFFFFFF;
+}
+
+static bool ParseNumber(const std::string& text, int& value)
+{
+	size_t end;
+	
+	try
+	{
+		value = std::stoi(text, &end);
+	}
+	catch (const std::invalid_argument&)
+	{
+		return false;
+	}
+	catch (const std::out_of_range&)
+	{
+		return false;
+	}
+	
+	return end == text.size();
+}
+
+// size,ways,line,latency
+static bool ParseCacheConfig(std::string text, CacheConfig& config)
+{
+	std::vector<std::string> fields = utils::split(text, ',');
+	
+	if (fields.size() != 4 || !ParseNumber(fields[0], config.size) || !ParseNumber(fields[1], config.ways)
+		|| !ParseNumber(fields[2], config.line_size) || !ParseNumber(fields[3], config.latency))
+	{
+		std::cout << "Cache configuration must be size,ways,line,latency" << std::endl;
+		return false;
+	}
+	
+	return true;
+}
+
+// name:jobs:quota,reservation,priority, with jobs a comma separated list of ids and first-last ranges
+static bool ParseMemoryGroup(std::string text, std::vector<MemoryGroupConfig>& groups)
+{
+	std::vector<std::string> parts = utils::split(text, ':');
+	std::vector<std::string> limits = parts.size() == 3 ? utils::split(parts[2], ',') : std::vector<std::string>();
+	MemoryGroupConfig group;
+	
+	if (parts.size() != 3 || parts[0] == "" || parts[1] == "" || limits.size() != 3
+		|| !ParseNumber(limits[0], group.quota) || !ParseNumber(limits[1], group.reservation) || !ParseNumber(limits[2], group.priority))
+	{
+		std::cout << "Memory group must be name:jobs:quota,reservation,priority" << std::endl;
+		return false;
+	}
+	
+	group.name = parts[0];
+	
+	std::vector<std::string> jobs = utils::split(parts[1], ',');
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		size_t dash = jobs[i].find('-');
+		unsigned int first;
+		unsigned int last;
+		
+		if (!ParseNumber(jobs[i].substr(0, dash), first) || !ParseNumber(dash == std::string::npos ? jobs[i] : jobs[i].substr(dash + 1), last))
+		{
+			std::cout << "Memory group must be name:jobs:quota,reservation,priority" << std::endl;
+			return false;
+		}
+		
+		for (unsigned int id = first; id <= last; id++)
+		{
+			group.jobs.insert(id);
+		}
+	}
+	
+	groups.push_back(group);
+	return true;
+}
+
+// job:file
+static bool ParseJobFile(std::string text, std::map<unsigned int, std::string>& files)
+{
+	size_t colon = text.find(':');
+	unsigned int job;
+	
+	if (colon == std::string::npos || colon + 1 == text.size() || !ParseNumber(text.substr(0, colon), job))
+	{
+		std::cout << "Channel must be job:file" << std::endl;
+		return false;
+	}
+	
+	files[job] = text.substr(colon + 1);
+	return true;
+}
+	
+bool Parse(int argc, char* argv[])
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string option = argv[i];
+		
+		if (option == "--host-mapped")
+		{
+			host_mapped = true;
+		}
+		else if (option == "--profiles" && i + 1 < argc)
+		{
+			profile_path = argv[++i];
+		}
+		else if (option == "--result-cache" && i + 1 < argc)
+		{
+			result_cache = argv[++i];
+		}
+		else if (option == "--native")
+		{
+			native = true;
+		}
+		else if (option == "--translate" && i + 1 < argc)
+		{
+			translate_path = argv[++i];
+		}
+		else if (option == "--layout" && i + 1 < argc)
+		{
+			layout_path = argv[++i];
+		}
+		else if (option == "--layout-profile" && i + 1 < argc)
+		{
+			layout_profile = argv[++i];
+		}
+		else if (option == "--migration-threshold" && i + 1 < argc)
+		{
+			migration_threshold = std::stoul(argv[++i]);
+		}
+		else if (option == "--cache")
+		{
+			cache_model = true;
+		}
+		else if (option == "--l1" && i + 1 < argc)
+		{
+			cache_model = true;
+			
+			if (!ParseCacheConfig(argv[++i], l1_cache))
+			{
+				return false;
+			}
+		}
+		else if (option == "--l2" && i + 1 < argc)
+		{
+			cache_model = true;
+			
+			if (!ParseCacheConfig(argv[++i], l2_cache))
+			{
+				return false;
+			}
+		}
+		else if (option == "--memory-latency" && i + 1 < argc)
+		{
+			memory_latency = std::stoul(argv[++i]);
+		}
+		else if (option == "--pipeline" && i + 1 < argc)
+		{
+			pipeline_model = true;
+			
+			if (!Pipeline::ParsePredictor(argv[++i], branch_predictor))
+			{
+				std::cout << "Branch predictor must be static, bimodal or gshare" << std::endl;
+				return false;
+			}
+		}
+		else if (option == "--btb" && i + 1 < argc)
+		{
+			pipeline.btb_entries = std::stoul(argv[++i]);
+			
+			if (pipeline.btb_entries == 0)
+			{
+				std::cout << "Branch target buffer needs at least one entry" << std::endl;
+				return false;
+			}
+		}
+		else if (option == "--disk-model" && i + 1 < argc)
+		{
+			disk_model = argv[++i];
+			
+			if (disk_model != "hdd" && disk_model != "ssd")
+			{
+				std::cout << "Disk model must be hdd or ssd" << std::endl;
+				return false;
+			}
+		}
+		else if (option == "--io-scheduler" && i + 1 < argc)
+		{
+			if (!DiskDevice::ParsePolicy(argv[++i], io_policy))
+			{
+				std::cout << "I/O scheduler must be fcfs, sstf, scan, cscan or deadline" << std::endl;
+				return false;
+			}
+		}
+		else if (option == "--io-deadline" && i + 1 < argc)
+		{
+			io_deadline = std::stoi(argv[++i]);
+		}
+		else if (option == "--quantum" && i + 1 < argc)
+		{
+			quantum = std::stoul(argv[++i]);
+			
+			if (quantum == 0)
+			{
+				std::cout << "Quantum must be at least one tick" << std::endl;
+				return false;
+			}
+		}
+		else if (option == "--resident-limit" && i + 1 < argc)
+		{
+			resident_limit = std::stoul(argv[++i]);
+		}
+		else if (option == "--group" && i + 1 < argc)
+		{
+			if (!ParseMemoryGroup(argv[++i], memory_groups))
+			{
+				return false;
+			}
+		}
+		else if (option == "--swap" && i + 1 < argc)
+		{
+			swap_budget = std::stoul(argv[++i]);
+		}
+		else if (option == "--input" && i + 1 < argc)
+		{
+			if (!ParseJobFile(argv[++i], input_files))
+			{
+				return false;
+			}
+		}
+		else if (option == "--output" && i + 1 < argc)
+		{
+			if (!ParseJobFile(argv[++i], output_files))
+			{
+				return false;
+			}
+		}
+		else if (option == "--results")
+		{
+			print_results = true;
+		}
+		else if (option == "--verify")
+		{
+			verify = true;
+		}
+		else if (option == "--lockstep")
+		{
+			lockstep = true;
+		}
+		else if (option == "--coordinator" && i + 1 < argc)
+		{
+			coordinator_socket = argv[++i];
+		}
+		else if (option == "--workers" && i + 1 < argc)
+		{
+			workers = std::stoul(argv[++i]);
+		}
+		else if (option == "--worker" && i + 1 < argc)
+		{
+			worker_socket = argv[++i];
+		}
+		else if (option == "--host-counters")
+		{
+			host_counters = true;
+		}
+		else if (option == "--guest-profile" && i + 1 < argc)
+		{
+			guest_profile = argv[++i];
+		}
+		else
+		{
+			std::cout << "Unknown option " << option << std::endl;
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+}
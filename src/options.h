@@ -0,0 +1,52 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "cache.h"
+#include "disk_model.h"
+#include "memory_groups.h"
+#include "pipeline.h"
+
+// command line options
+namespace options
+{
+extern bool host_mapped; // --host-mapped: run processes in host MMU backed address spaces
+extern unsigned int migration_threshold; // --migration-threshold <n>: queue length imbalance before an idle CPU steals work
+extern unsigned int quantum; // --quantum <ticks>: how often SRTF reconsiders the running process
+extern unsigned int resident_limit; // --resident-limit <pages>: frames a process may hold before its oldest page is evicted, 0 for no limit
+extern std::vector<MemoryGroupConfig> memory_groups; // --group <name>:<jobs>:<quota,reservation,priority>: jobs (ids and first-last ranges, comma separated) sharing a frame quota
+extern unsigned int swap_budget; // --swap <bytes>: compressed swap tier for evicted pages, 0 writes them straight to disk
+extern bool cache_model; // --cache: charge memory accesses through the cache hierarchy model
+extern CacheConfig l1_cache; // --l1 <size,ways,line,latency>: each CPU's L1 I and D caches
+extern CacheConfig l2_cache; // --l2 <size,ways,line,latency>: the shared L2
+extern unsigned int memory_latency; // --memory-latency <cycles>
+extern bool pipeline_model; // --pipeline <static|bimodal|gshare>: time instructions through the pipeline model with that branch predictor
+extern Pipeline::PREDICTORS branch_predictor;
+extern PipelineConfig pipeline; // --btb <entries>: size of the branch target buffer
+extern std::string disk_model; // --disk-model <hdd|ssd>: page-ins wait for a simulated disk, "" serves them instantly
+extern DiskDevice::POLICIES io_policy; // --io-scheduler <fcfs|sstf|scan|cscan|deadline>
+extern int io_deadline; // --io-deadline <ticks>: how long a request may wait under the deadline policy
+extern std::map<unsigned int, std::string> input_files; // --input <job>:<file>: records to run the job over, one per line
+extern std::map<unsigned int, std::string> output_files; // --output <job>:<file>: the job's output buffer after each run, one line each
+extern bool print_results; // --results: print each finished job's output buffer, read back from disk
+extern std::string guest_profile; // --guest-profile <file>: per instruction execution and fault counts of every job, "" for none
+extern bool lockstep; // --lockstep: run jobs with the same code side by side in SIMD lanes instead of scheduling them
+extern std::string coordinator_socket; // --coordinator <socket>: hand the jobs to worker processes instead of running them, "" to run them here
+extern unsigned int workers; // --workers <n>: local workers the coordinator forks, others may connect to its socket
+extern std::string worker_socket; // --worker <socket>: run jobs for the coordinator listening there
+extern bool host_counters; // --host-counters: report host time and hardware counters per phase of the run
+extern bool native; // --native: run jobs whose image is in the precompiled job library as native code
+extern std::string layout_path; // --layout <file>: write the deck out with its hot code and data in fewer pages and exit
+extern std::string layout_profile; // --layout-profile <file>: the .folded counts of a --guest-profile run to find hot code by, loops otherwise
+extern std::string translate_path; // --translate <file>: write the deck's jobs out as a precompiled job library and exit
+extern bool verify; // --verify: statically verify jobs at load time and run the verified ones without page checks
+extern std::string profile_path; // --profiles <file>: job profiles to predict from and record into
+extern std::string result_cache; // --result-cache <file>: results of earlier runs to replay instead of executing, and to record into
+
+// reads the options out of the command line. returns false on an unknown option
+bool Parse(int argc, char* argv[]);
+}
+
+#endif // OPTIONS_H
@@ -0,0 +1,173 @@
+#ifndef PAGE_TABLE_H
+#define PAGE_TABLE_H
+
+#include <array>
+#include <vector>
+#include <stdint.h>
+#include "machine_config.h"
+
+// a process' page table over the whole 32 bit logical address space, as a 3 level radix tree.
+// a leaf holds PAGE_TABLE_LENGTH entries, so a job that fits the old flat table uses one leaf,
+// and the root and middle levels split the page number bits above it. levels are allocated the
+// first time a page under them is mapped and Clear gives them all back. nodes live in pools and
+// point at each other by index, so the table copies like a value.
+// lookups go through a small software TLB of recently used leaves. leaves are only dropped by
+// Clear, so an entry never goes stale and unmapping a page needs no shootdown
+class PageTable
+{
+public:
+	static const uint32_t INVALID = 0xFFFFFFFF; // frame of a page that is not resident
+	
+	static constexpr unsigned int PAGE_BITS = 32 - Machine::FRAME_SHIFT;
+	static constexpr unsigned int LEAF_BITS = Machine::Log2(Machine::PAGE_TABLE_LENGTH);
+	static constexpr unsigned int MIDDLE_BITS = (PAGE_BITS - LEAF_BITS) / 2;
+	static constexpr unsigned int ROOT_BITS = PAGE_BITS - LEAF_BITS - MIDDLE_BITS;
+	static constexpr unsigned int TLB_ENTRIES = 4; // direct mapped on the bits above the leaf
+
+private:
+	static const uint32_t NONE = 0xFFFFFFFF; // no node below
+	
+	typedef std::array<uint32_t, 1 << LEAF_BITS> Leaf; // frame index per page
+	typedef std::array<uint32_t, 1 << MIDDLE_BITS> Middle; // leaf index per entry
+	
+	std::vector<uint32_t> root_; // middle index per entry, empty until the first page is mapped
+	std::vector<Middle> middles_;
+	std::vector<Leaf> leaves_;
+	
+	struct TlbEntry
+	{
+		uint32_t tag; // page number without its leaf bits
+		uint32_t leaf;
+	};
+	
+	mutable std::array<TlbEntry, TLB_ENTRIES> tlb_;
+	
+	// the leaf the page falls in, NONE if nothing under it was ever mapped
+	uint32_t FindLeaf(uint32_t page) const
+	{
+		uint32_t tag = page >> LEAF_BITS;
+		TlbEntry& entry = tlb_[tag % TLB_ENTRIES];
+		
+		if (entry.tag == tag)
+		{
+			return entry.leaf;
+		}
+		
+		if (root_.empty())
+		{
+			return NONE;
+		}
+		
+		uint32_t middle = root_[tag >> MIDDLE_BITS];
+		
+		if (middle == NONE)
+		{
+			return NONE;
+		}
+		
+		uint32_t leaf = middles_[middle][tag & ((1 << MIDDLE_BITS) - 1)];
+		
+		if (leaf != NONE)
+		{
+			entry = TlbEntry{tag, leaf};
+		}
+		
+		return leaf;
+	}
+
+public:
+	PageTable()
+	{
+		Clear();
+	}
+	
+	// frame index of the page, INVALID if it is not resident
+	uint32_t operator[](uint32_t page) const
+	{
+		uint32_t leaf = FindLeaf(page);
+		
+		return leaf == NONE ? INVALID : leaves_[leaf][page & ((1 << LEAF_BITS) - 1)];
+	}
+	
+	// maps or, with INVALID, unmaps a page, allocating the levels above it as needed
+	void Set(uint32_t page, uint32_t frame)
+	{
+		uint32_t leaf = FindLeaf(page);
+		
+		if (leaf == NONE)
+		{
+			if (frame == INVALID)
+			{
+				return;
+			}
+			
+			uint32_t tag = page >> LEAF_BITS;
+			
+			if (root_.empty())
+			{
+				root_.assign(1 << ROOT_BITS, NONE);
+			}
+			
+			uint32_t& middle = root_[tag >> MIDDLE_BITS];
+			
+			if (middle == NONE)
+			{
+				middle = middles_.size();
+				middles_.emplace_back();
+				middles_.back().fill(NONE);
+			}
+			
+			leaf = leaves_.size();
+			leaves_.emplace_back();
+			leaves_.back().fill(INVALID);
+			middles_[middle][tag & ((1 << MIDDLE_BITS) - 1)] = leaf;
+		}
+		
+		leaves_[leaf][page & ((1 << LEAF_BITS) - 1)] = frame;
+	}
+	
+	// unmaps every page and frees the levels
+	void Clear()
+	{
+		root_ = std::vector<uint32_t>();
+		middles_ = std::vector<Middle>();
+		leaves_ = std::vector<Leaf>();
+		tlb_.fill(TlbEntry{NONE, NONE});
+	}
+	
+	// calls f(page, frame) for every resident page
+	template<typename F>
+	void ForEachMapped(F f) const
+	{
+		for (uint32_t top = 0; top < root_.size(); top++)
+		{
+			if (root_[top] == NONE)
+			{
+				continue;
+			}
+			
+			const Middle& middle = middles_[root_[top]];
+			
+			for (uint32_t i = 0; i < middle.size(); i++)
+			{
+				if (middle[i] == NONE)
+				{
+					continue;
+				}
+				
+				const Leaf& leaf = leaves_[middle[i]];
+				uint32_t first_page = ((top << MIDDLE_BITS) | i) << LEAF_BITS;
+				
+				for (uint32_t j = 0; j < leaf.size(); j++)
+				{
+					if (leaf[j] != INVALID)
+					{
+						f(first_page | j, leaf[j]);
+					}
+				}
+			}
+		}
+	}
+};
+
+#endif // PAGE_TABLE_H
@@ -2,16 +2,41 @@
 #define PCB_H
 
 #include "iostream"
+#include <array>
+#include <deque>
+#include <vector>
+#include "types.h"
+#include "machine_config.h"
+#include "page_table.h"
+#include "native.h"
+
+class AddressSpace;
+
+// a point in a run where its paging changed, for result memoization
+struct PagingEvent
+{
+	unsigned long instructions; // retired before it
+	uint32_t page;
+	bool fault; // otherwise the first store to the page since it was loaded
+};
 
 // process control block
 struct PCB
 {
+	typedef ::PageTable PageTable;
+	
 	unsigned int id;
 	unsigned int priority;
 	
 	int cpu_id;
+	int last_cpu; // CPU the process last ran on, -1 if it never ran
 	uint32_t program_counter; // logical address
-	uint32_t* page_table;
+	PageTable page_table; // frame index per page, 0xFFFFFFFF if not resident
+	unsigned int anonymous_pages; // zero filled pages beyond the disk image, resident until the process exits
+	AddressSpace* address_space; // host mapping of the logical address space, NULL unless running mapped
+	std::deque<uint32_t> resident_pages; // in load order, the oldest is evicted first
+	std::vector<bool> paged_out; // per page of the image, evicted, held by the swap tier or written back to disk
+	std::vector<bool> dirty_pages; // per page of the image, stored to since they were last read from disk
 
 	unsigned int program_size; // in bytes
 	unsigned int input_buffer_offset; // relative to base address
@@ -19,38 +44,121 @@ struct PCB
 	unsigned int temp_buffer_offset;
 	
 	uint32_t disk_address; // base address of program in disk
+	uint64_t content_hash; // hash of the job's disk image
+	
+	bool verified; // passed the load-time verifier, runs without page checks once the footprint is resident
+	std::vector<uint32_t> footprint; // pages a verified job can touch
+	
+	native::JobFunction native; // precompiled translation of the job's code, NULL to interpret it
+	unsigned int min_frames; // most pages one of its instructions needs at once, the resident limit never goes below it
+	unsigned int memory_group; // index in MemoryGroups, 0 for the default group
 	
-	uint32_t registers[16];
+	std::array<types::Word, Machine::REGISTER_COUNT> registers;
 	
 	enum STATUS {READY, RUNNING, WAITING, BLOCKED, TERMINATED};
+	enum CACHE_LEVEL {L1I, L1D, L2};
 	STATUS status;
 	
 	uint32_t page_fault_index;
 	
 	// METRICS
+	int arrival_time;
+	int ready_since; // when the process last became ready or blocked, off any CPU
+	int finish_time; // end of the tick it terminated in, -1 while it has not
 	int io_ops;
-	int wait_time;
-	int completion_time;
+	int wait_time; // ticks spent off a CPU
+	int completion_time; // ticks spent on a CPU
+	unsigned long instructions; // retired
+	unsigned int page_faults;
+	unsigned int bursts; // finished CPU bursts
+	unsigned long burst_length; // instructions retired in the current CPU burst
+	unsigned long cycles; // one per instruction plus memory hierarchy latencies
+	unsigned long cache_hits[3]; // by CACHE_LEVEL
+	unsigned long cache_misses[3];
+	unsigned long pipeline_cycles; // under the pipeline model, from fetch of the first instruction
+	unsigned long hazard_stalls; // cycles instructions waited for operands or a busy divider
+	unsigned long branches; // conditional ones retired
+	unsigned long mispredictions;
+	
+	// guest profiler, per code word. empty unless profiling
+	std::vector<unsigned long> pc_executions; // retired
+	std::vector<unsigned long> pc_faults; // page faults taken
+	
+	// result memoization
+	std::vector<PagingEvent> paging_trace; // recorded as the job executes, followed when it replays
+	bool replaying; // follows paging_trace up to replay_instructions instead of executing
+	unsigned long replay_instructions;
+	size_t replay_next; // next event of the trace
 	
 	PCB()
 	{
 		cpu_id = -1;
+		last_cpu = -1;
 		program_size = 0;
 		program_counter = 0;
+		content_hash = 0;
+		verified = false;
+		native = NULL;
+		min_frames = 1;
+		memory_group = 0;
 		
 		registers[1] = 0; // the Zero register
 		
-		page_table = new uint32_t[0x40];
-		
-		for (int i = 0; i < 0x40; i++)
-		{
-			page_table[i] = 0xFFFFFFFF; // invalid page
-		}
+		anonymous_pages = 0;
+		replaying = false;
+		replay_instructions = 0;
+		replay_next = 0;
+		address_space = NULL;
 		
 		// METRICS
+		arrival_time = 0;
+		ready_since = 0;
+		finish_time = -1;
 		io_ops = 0;
 		wait_time = 0;
 		completion_time = 0;
+		instructions = 0;
+		page_faults = 0;
+		bursts = 0;
+		burst_length = 0;
+		cycles = 0;
+		pipeline_cycles = 0;
+		hazard_stalls = 0;
+		branches = 0;
+		mispredictions = 0;
+		
+		for (int i = 0; i < 3; i++)
+		{
+			cache_hits[i] = 0;
+			cache_misses[i] = 0;
+		}
+	}
+	
+	// pages past the image have nothing on disk, they are zero filled when first touched
+	bool InImage(uint32_t page) const
+	{
+		return page < Machine::PagesFor(program_size);
+	}
+	
+	// sizes the per-page flags to the image, once program_size is known
+	void SizePageFlags()
+	{
+		paged_out.assign(Machine::PagesFor(program_size), false);
+		dirty_pages.assign(Machine::PagesFor(program_size), false);
+	}
+	
+	// only pages of the image are ever written back
+	void MarkDirty(uint32_t page)
+	{
+		if (InImage(page) && !dirty_pages[page])
+		{
+			dirty_pages[page] = true;
+			
+			if (!replaying)
+			{
+				paging_trace.push_back(PagingEvent{instructions, page, false});
+			}
+		}
 	}
 };
 
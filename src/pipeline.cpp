@@ -0,0 +1,165 @@
+#include "pipeline.h"
+#include <algorithm>
+#include "isa.h"
+
+Pipeline::Pipeline(PREDICTORS predictor, PipelineConfig config)
+{
+	predictor_ = predictor;
+	config_ = config;
+	
+	counters_.assign(1 << config.history_bits, 1); // weakly not taken
+	history_ = 0;
+	btb_.assign(config.btb_entries, BtbEntry{0, 0, false});
+	
+	issue_ = 0;
+	Flush();
+}
+
+bool Pipeline::ParsePredictor(std::string name, PREDICTORS& predictor)
+{
+	const char* names[] = {"static", "bimodal", "gshare"};
+	
+	for (int i = 0; i < 3; i++)
+	{
+		if (name == names[i])
+		{
+			predictor = static_cast<PREDICTORS>(i);
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+void Pipeline::Flush()
+{
+	// the next instruction is fetched and decoded before it gets to EX
+	next_issue_ = issue_ + 3;
+	ex_free_ = 0;
+	
+	for (int i = 0; i < Machine::REGISTER_COUNT; i++)
+	{
+		ready_[i] = 0;
+	}
+}
+
+uint8_t& Pipeline::Counter(uint32_t pc)
+{
+	uint32_t index = pc / sizeof(types::Word);
+	
+	if (predictor_ == GSHARE)
+	{
+		index ^= history_;
+	}
+	
+	return counters_[index & (counters_.size() - 1)];
+}
+
+bool Pipeline::Predict(uint32_t pc, uint32_t target)
+{
+	if (predictor_ == STATIC)
+	{
+		return target <= pc;
+	}
+	
+	return Counter(pc) >= 2;
+}
+
+unsigned int Pipeline::Branch(PCB& process, uint32_t pc, uint32_t target, uint32_t next_pc, bool conditional)
+{
+	bool taken = next_pc != pc + sizeof(types::Word);
+	bool predict_taken = conditional ? Predict(pc, target) : true;
+	
+	BtbEntry& entry = btb_[(pc / sizeof(types::Word)) % btb_.size()];
+	bool btb_hit = entry.valid && entry.pc == pc;
+	bool stale_target = btb_hit && entry.target != next_pc;
+	
+	if (taken)
+	{
+		entry = BtbEntry{pc, next_pc, true};
+	}
+	
+	if (conditional)
+	{
+		process.branches++;
+		
+		if (predictor_ != STATIC)
+		{
+			uint8_t& counter = Counter(pc);
+			counter = taken ? std::min(counter + 1, 3) : std::max(counter - 1, 0);
+			history_ = ((history_ << 1) | (taken ? 1 : 0)) & (counters_.size() - 1);
+		}
+	}
+	
+	// wrong direction, or a stale target from the BTB: refetch once the branch leaves EX
+	if (predict_taken != taken || (taken && stale_target))
+	{
+		process.mispredictions++;
+		return 2;
+	}
+	
+	// taken without a BTB hit: the target is only known once the branch is decoded
+	if (taken && !btb_hit)
+	{
+		return 1;
+	}
+	
+	return 0;
+}
+
+void Pipeline::Retire(PCB& process, uint32_t pc, types::Word word, unsigned long memory_stall)
+{
+	const isa::Instruction instruction = isa::Decode(word);
+	const isa::OpcodeInfo& info = isa::OPCODE_TABLE[instruction.opcode];
+	const isa::Operands operands = isa::RegisterOperands(instruction);
+	
+	unsigned long earliest = std::max(next_issue_ + memory_stall, ex_free_);
+	unsigned long issue = earliest;
+	
+	// operands forward from EX or MEM, waiting only until they are produced
+	for (int i = 0; i < 2; i++)
+	{
+		if (operands.sources[i] >= 0)
+		{
+			issue = std::max(issue, ready_[operands.sources[i]]);
+		}
+	}
+	
+	process.hazard_stalls += issue - earliest;
+	
+	unsigned int latency = 1;
+	
+	if (instruction.opcode == isa::MUL || instruction.opcode == isa::MULI)
+	{
+		latency = config_.multiply_latency;
+	}
+	else if (instruction.opcode == isa::DIV || instruction.opcode == isa::DIVI)
+	{
+		latency = config_.divide_latency;
+		ex_free_ = issue + latency;
+	}
+	else if (info.reads_memory)
+	{
+		latency = 2; // through MEM
+	}
+	
+	if (operands.destination >= 0)
+	{
+		ready_[operands.destination] = issue + latency;
+	}
+	
+	process.pipeline_cycles += issue - issue_;
+	issue_ = issue;
+	next_issue_ = issue + 1;
+	
+	if (info.branch)
+	{
+		next_issue_ += Branch(process, pc, instruction.address, process.program_counter, info.conditional);
+	}
+	
+	// the last instruction still has to get through MEM and WB
+	if (info.ends_program)
+	{
+		process.pipeline_cycles += 2;
+	}
+}
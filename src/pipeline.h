@@ -0,0 +1,73 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "machine_config.h"
+#include "pcb.h"
+#include "types.h"
+
+struct PipelineConfig
+{
+	unsigned int history_bits; // 2-bit counters in the predictor table, log2
+	unsigned int btb_entries; // direct mapped branch target buffer
+	unsigned int multiply_latency; // cycles in EX
+	unsigned int divide_latency; // cycles in EX, not pipelined
+};
+
+// cycle timing model of a classic in-order 5 stage pipeline, IF ID EX MEM WB, one per CPU.
+// the interpreter still executes each instruction whole, the model is told about every retired
+// instruction and works out the cycle it entered EX in. results forward from EX and MEM, so only
+// a use right after a load, long latency operations and branches cost bubbles. conditional
+// branches resolve in EX. a predicted taken branch fetches its target straight away on a BTB hit
+// and from ID on a miss. cycles and branch statistics are charged to the process
+class Pipeline
+{
+public:
+	enum PREDICTORS {STATIC, BIMODAL, GSHARE}; // STATIC predicts backward branches taken, forward ones not
+
+private:
+	struct BtbEntry
+	{
+		uint32_t pc;
+		uint32_t target;
+		bool valid;
+	};
+	
+	PREDICTORS predictor_;
+	PipelineConfig config_;
+	
+	std::vector<uint8_t> counters_; // 2-bit saturating, taken from 2 up
+	uint32_t history_; // global branch outcomes, newest in bit 0
+	std::vector<BtbEntry> btb_;
+	
+	// in cycles of this pipeline
+	unsigned long issue_; // when the last instruction entered EX
+	unsigned long next_issue_; // earliest the front end can have the next instruction in EX
+	unsigned long ex_free_; // when EX takes a new instruction, after a divide
+	unsigned long ready_[Machine::REGISTER_COUNT]; // when each register's value can be forwarded
+	
+	uint8_t& Counter(uint32_t pc);
+	
+	// direction guess for a conditional branch to target
+	bool Predict(uint32_t pc, uint32_t target);
+	
+	// cycles the front end loses after a branch, and whether it was mispredicted
+	unsigned int Branch(PCB& process, uint32_t pc, uint32_t target, uint32_t next_pc, bool conditional);
+
+public:
+	Pipeline(PREDICTORS predictor, PipelineConfig config);
+	
+	// parses a predictor name, returns false if it is unknown
+	static bool ParsePredictor(std::string name, PREDICTORS& predictor);
+	
+	// empties the pipeline, as on a context switch or a fault. predictor and BTB state is kept
+	void Flush();
+	
+	// times the instruction at pc that just retired, the process' PC already points past it.
+	// memory_stall is what the cache hierarchy charged beyond one cycle, it holds up the whole pipeline
+	void Retire(PCB& process, uint32_t pc, types::Word instruction, unsigned long memory_stall);
+};
+
+#endif // PIPELINE_H
@@ -0,0 +1,184 @@
+#include "profile_store.h"
+#include "types.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+// static estimate of a job's length, used when it has no profile
+static double StaticEstimate(PCB& job)
+{
+	return job.input_buffer_offset / (double)sizeof(types::Word); // code words
+}
+
+ProfileStore::ProfileStore(double alpha)
+{
+	alpha_ = alpha;
+}
+
+bool ProfileStore::Load(std::string file_path)
+{
+	std::ifstream profile_file(file_path);
+	
+	if (!profile_file.is_open())
+	{
+		return false;
+	}
+	
+	std::string header;
+	getline(profile_file, header);
+	
+	JobProfile profile;
+	
+	while (profile_file >> std::dec >> profile.id >> std::hex >> profile.content_hash >> std::dec >> profile.runs >> profile.code_words
+			>> profile.instructions >> profile.page_faults >> profile.bursts
+			>> profile.predicted_run >> profile.predicted_burst)
+	{
+		profiles_[std::make_pair(profile.id, profile.content_hash)] = profile;
+	}
+	
+	return true;
+}
+
+bool ProfileStore::Save(std::string file_path)
+{
+	std::ofstream profile_file(file_path);
+	
+	if (!profile_file.is_open())
+	{
+		std::cout << "Cannot write profiles to " << file_path << std::endl;
+		return false;
+	}
+	
+	profile_file << "# id hash runs code_words instructions page_faults bursts predicted_run predicted_burst" << std::endl;
+	
+	for (std::map<std::pair<unsigned int, uint64_t>, JobProfile>::iterator it = profiles_.begin(); it != profiles_.end(); it++)
+	{
+		JobProfile& profile = it->second;
+		
+		profile_file << std::dec << profile.id << " " << std::hex << profile.content_hash << " " << std::dec << profile.runs << " " << profile.code_words << " "
+					 << profile.instructions << " " << profile.page_faults << " " << profile.bursts << " "
+					 << profile.predicted_run << " " << profile.predicted_burst << std::endl;
+	}
+	
+	return true;
+}
+
+JobProfile& ProfileStore::Get(PCB& job)
+{
+	std::pair<unsigned int, uint64_t> key = std::make_pair(job.id, job.content_hash);
+	
+	if (profiles_.find(key) == profiles_.end())
+	{
+		JobProfile profile;
+		profile.id = job.id;
+		profile.content_hash = job.content_hash;
+		profile.runs = 0;
+		profile.code_words = StaticEstimate(job);
+		profile.instructions = 0;
+		profile.page_faults = 0;
+		profile.bursts = 0;
+		profile.predicted_run = 0;
+		profile.predicted_burst = 0;
+		
+		profiles_[key] = profile;
+	}
+	
+	return profiles_[key];
+}
+
+const JobProfile* ProfileStore::Find(PCB& job)
+{
+	std::map<std::pair<unsigned int, uint64_t>, JobProfile>::iterator it = profiles_.find(std::make_pair(job.id, job.content_hash));
+	
+	if (it == profiles_.end() || it->second.runs == 0)
+	{
+		return NULL;
+	}
+	
+	return &it->second;
+}
+
+void ProfileStore::RecordBurst(PCB& job)
+{
+	JobProfile& profile = Get(job);
+	
+	// the first burst seeds the prediction
+	if (profile.predicted_burst == 0)
+	{
+		profile.predicted_burst = job.burst_length;
+	}
+	else
+	{
+		profile.predicted_burst = alpha_ * job.burst_length + (1 - alpha_) * profile.predicted_burst;
+	}
+	
+	job.bursts++;
+	job.burst_length = 0;
+}
+
+void ProfileStore::RecordRun(PCB& job)
+{
+	JobProfile& profile = Get(job);
+	
+	if (profile.runs == 0)
+	{
+		profile.predicted_run = job.instructions;
+	}
+	else
+	{
+		profile.predicted_run = alpha_ * job.instructions + (1 - alpha_) * profile.predicted_run;
+	}
+	
+	profile.runs++;
+	profile.instructions = job.instructions;
+	profile.page_faults = job.page_faults;
+	profile.bursts = job.bursts;
+}
+
+double ProfileStore::PredictRun(PCB& job)
+{
+	const JobProfile* profile = Find(job);
+	
+	if (profile != NULL)
+	{
+		return profile->predicted_run;
+	}
+	
+	// learn how far code size is from the real run length on the jobs that were seen
+	double scale = 0;
+	int seen = 0;
+	
+	for (std::map<std::pair<unsigned int, uint64_t>, JobProfile>::iterator it = profiles_.begin(); it != profiles_.end(); it++)
+	{
+		if (it->second.runs > 0 && it->second.code_words > 0)
+		{
+			scale += it->second.predicted_run / it->second.code_words;
+			seen++;
+		}
+	}
+	
+	return StaticEstimate(job) * (seen > 0 ? scale / seen : 1);
+}
+
+double ProfileStore::PredictRemaining(PCB& job)
+{
+	double remaining = PredictRun(job) - job.instructions;
+	
+	return remaining > 0 ? remaining : 0;
+}
+
+double ProfileStore::PredictBurst(PCB& job)
+{
+	const JobProfile* profile = Find(job);
+	
+	double remaining = PredictRemaining(job);
+	
+	if (profile == NULL || profile->predicted_burst == 0)
+	{
+		return remaining;
+	}
+	
+	double burst = profile->predicted_burst - job.burst_length;
+	
+	return std::max(std::min(burst, remaining), 0.0);
+}
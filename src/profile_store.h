@@ -0,0 +1,68 @@
+#ifndef PROFILE_STORE_H
+#define PROFILE_STORE_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <stdint.h>
+#include "pcb.h"
+
+// what past runs of a job looked like
+struct JobProfile
+{
+	unsigned int id;
+	uint64_t content_hash;
+	
+	unsigned int runs;
+	unsigned int code_words; // static size estimate, to calibrate estimates for unseen jobs
+	
+	// last run
+	unsigned long instructions;
+	unsigned int page_faults;
+	unsigned int bursts;
+	
+	// exponential averages
+	double predicted_run; // instructions per run
+	double predicted_burst; // instructions per CPU burst
+};
+
+// per-job runtime profiles keyed by job id and content hash, used for burst prediction.
+// each new observation t updates a prediction p as p = alpha * t + (1 - alpha) * p
+class ProfileStore
+{
+private:
+	std::map<std::pair<unsigned int, uint64_t>, JobProfile> profiles_;
+	double alpha_;
+	
+	JobProfile& Get(PCB& job);
+	
+public:
+	ProfileStore(double alpha = 0.5);
+	
+	// reads/writes profiles from/to a text file
+	bool Load(std::string file_path);
+	bool Save(std::string file_path);
+	
+	// profile of the job, NULL if it never ran with this code
+	const JobProfile* Find(PCB& job);
+	
+	// folds the job's finished CPU burst into its burst prediction and resets the burst counter
+	void RecordBurst(PCB& job);
+	
+	// folds the job's finished run into its run prediction
+	void RecordRun(PCB& job);
+	
+	// predicted instructions for a whole run. unseen jobs fall back to their code size,
+	// scaled by how far off code size has been for the jobs that were seen
+	double PredictRun(PCB& job);
+	
+	// predicted instructions left in the current run
+	double PredictRemaining(PCB& job);
+	
+	// predicted instructions left in the job's current CPU burst, its whole next burst if it is
+	// not running. a burst ends at the end of the run at the latest, and jobs that never ran
+	// with this code fall back to what is left of their run
+	double PredictBurst(PCB& job);
+};
+
+#endif // PROFILE_STORE_H
@@ -0,0 +1,197 @@
+#include "result_cache.h"
+#include <fstream>
+#include <iostream>
+#include "isa.h"
+
+ResultCache::ResultCache(unsigned int resident_limit)
+{
+	resident_limit_ = resident_limit;
+	
+	replayed_ = 0;
+	recorded_ = 0;
+	instructions_skipped_ = 0;
+}
+
+ResultCache::Key ResultCache::KeyOf(PCB& job)
+{
+	return Key(job.content_hash, resident_limit_, job.verified);
+}
+
+bool ResultCache::Load(std::string file_path)
+{
+	std::ifstream run_file(file_path);
+	
+	if (!run_file.is_open())
+	{
+		return false;
+	}
+	
+	std::string header;
+	getline(run_file, header);
+	
+	MemoizedRun run;
+	size_t num_events;
+	size_t num_words;
+	
+	while (run_file >> std::hex >> run.content_hash >> std::dec >> run.resident_limit >> run.verified >> run.instructions >> run.io_ops)
+	{
+		for (unsigned int i = 0; i < Machine::REGISTER_COUNT; i++)
+		{
+			run_file >> std::hex >> run.registers[i];
+		}
+		
+		run_file >> std::dec >> num_events;
+		run.paging_trace.resize(num_events);
+		
+		for (size_t i = 0; i < num_events; i++)
+		{
+			run_file >> std::dec >> run.paging_trace[i].instructions >> run.paging_trace[i].page >> run.paging_trace[i].fault;
+		}
+		
+		run_file >> std::dec >> num_words;
+		run.image.resize(num_words);
+		
+		for (size_t i = 0; i < num_words; i++)
+		{
+			run_file >> std::hex >> run.image[i];
+		}
+		
+		if (!run_file)
+		{
+			std::cout << "Result cache " << file_path << " is damaged, ignoring the rest" << std::endl;
+			break;
+		}
+		
+		runs_[Key(run.content_hash, run.resident_limit, run.verified)] = run;
+	}
+	
+	return true;
+}
+
+bool ResultCache::Save(std::string file_path)
+{
+	std::ofstream run_file(file_path);
+	
+	if (!run_file.is_open())
+	{
+		std::cout << "Cannot write results to " << file_path << std::endl;
+		return false;
+	}
+	
+	run_file << "# hash resident_limit verified instructions io_ops registers... events (instructions page fault)... words image..." << std::endl;
+	
+	for (std::map<Key, MemoizedRun>::iterator it = runs_.begin(); it != runs_.end(); it++)
+	{
+		MemoizedRun& run = it->second;
+		
+		run_file << std::hex << run.content_hash << std::dec << " " << run.resident_limit << " " << run.verified << " " << run.instructions << " " << run.io_ops << std::hex;
+		
+		for (unsigned int i = 0; i < Machine::REGISTER_COUNT; i++)
+		{
+			run_file << " " << run.registers[i];
+		}
+		
+		run_file << std::dec << " " << run.paging_trace.size();
+		
+		for (size_t i = 0; i < run.paging_trace.size(); i++)
+		{
+			run_file << " " << run.paging_trace[i].instructions << " " << run.paging_trace[i].page << " " << run.paging_trace[i].fault;
+		}
+		
+		run_file << " " << run.image.size() << std::hex;
+		
+		for (size_t i = 0; i < run.image.size(); i++)
+		{
+			run_file << " " << run.image[i];
+		}
+		
+		run_file << std::dec << std::endl;
+	}
+	
+	return true;
+}
+
+bool ResultCache::Prepare(PCB& job)
+{
+	std::map<Key, MemoizedRun>::iterator it = runs_.find(KeyOf(job));
+	
+	if (it == runs_.end())
+	{
+		return false;
+	}
+	
+	job.replaying = true;
+	job.replay_instructions = it->second.instructions;
+	job.replay_next = 0;
+	job.paging_trace = it->second.paging_trace;
+	return true;
+}
+
+void ResultCache::Finish(PCB& job, Disk& disk, MemManager& mmu)
+{
+	uint32_t num_words = job.program_size / sizeof(types::Word);
+	
+	if (job.replaying)
+	{
+		MemoizedRun& run = runs_[KeyOf(job)];
+		CacheHierarchy* caches = mmu.GetCacheHierarchy();
+		
+		for (uint32_t i = 0; i < num_words && i < run.image.size(); i++)
+		{
+			uint32_t offset = i * sizeof(types::Word);
+			disk.Write(job.disk_address + offset, &run.image[i], sizeof(types::Word));
+			
+			uint32_t frame = job.page_table[Machine::PageOf(offset)];
+			
+			if (frame != PageTable::INVALID)
+			{
+				uint32_t absolute_address = mmu.GetFrameAddress(frame) | Machine::OffsetOf(offset);
+				mmu.StoreWord(absolute_address, run.image[i]);
+				
+				if (caches != NULL)
+				{
+					caches->InvalidateRange(absolute_address, sizeof(types::Word));
+				}
+			}
+		}
+		
+		job.registers = run.registers;
+		job.io_ops = run.io_ops;
+		
+		replayed_++;
+		instructions_skipped_ += run.instructions;
+		return;
+	}
+	
+	// a run that stopped on an error is not worth reproducing
+	types::Word last;
+	disk.Read(job.disk_address + job.program_counter, &last, sizeof(last));
+	
+	if (job.program_counter >= job.program_size || isa::Decode(last).opcode != isa::HLT)
+	{
+		return;
+	}
+	
+	MemoizedRun& run = runs_[KeyOf(job)];
+	run.content_hash = job.content_hash;
+	run.resident_limit = resident_limit_;
+	run.verified = job.verified;
+	run.instructions = job.instructions;
+	run.io_ops = job.io_ops;
+	run.registers = job.registers;
+	run.paging_trace = job.paging_trace;
+	run.image.resize(num_words);
+	
+	for (uint32_t i = 0; i < num_words; i++)
+	{
+		disk.Read(job.disk_address + i * sizeof(types::Word), &run.image[i], sizeof(types::Word));
+	}
+	
+	recorded_++;
+}
+
+void ResultCache::PrintStatistics()
+{
+	std::cout << std::dec << "Result cache: " << replayed_ << " jobs replayed, " << instructions_skipped_ << " guest instructions not executed, "
+			  << recorded_ << " runs recorded" << std::endl;
+}
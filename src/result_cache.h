@@ -0,0 +1,66 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <array>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <stdint.h>
+#include "disk.h"
+#include "machine_config.h"
+#include "memory_manager.h"
+#include "pcb.h"
+#include "types.h"
+
+// a finished run of a job, enough to reproduce its results and its paging without executing it
+struct MemoizedRun
+{
+	uint64_t content_hash; // of the image it started from
+	unsigned int resident_limit; // paging depends on it
+	bool verified; // so does preloading the footprint
+	
+	unsigned long instructions;
+	int io_ops;
+	std::array<types::Word, Machine::REGISTER_COUNT> registers;
+	std::vector<PagingEvent> paging_trace;
+	std::vector<types::Word> image; // once it halted
+};
+
+// results of deterministic runs keyed by the job's content hash, kept in a text file across runs.
+// a job seen before replays its recorded paging events through the scheduler instead of
+// executing, and gets its final image and registers back when it terminates. only runs that
+// ended on HLT are kept
+class ResultCache
+{
+private:
+	typedef std::tuple<uint64_t, unsigned int, bool> Key;
+	
+	std::map<Key, MemoizedRun> runs_;
+	unsigned int resident_limit_;
+	
+	// statistics
+	unsigned int replayed_;
+	unsigned int recorded_;
+	unsigned long instructions_skipped_;
+	
+	Key KeyOf(PCB& job);
+
+public:
+	ResultCache(unsigned int resident_limit);
+	
+	// reads/writes runs from/to a text file
+	bool Load(std::string file_path);
+	bool Save(std::string file_path);
+	
+	// sets the job up to replay if it ran before. returns true if it will
+	bool Prepare(PCB& job);
+	
+	// call when the job has terminated and its image is back on disk. a replayed job's results are
+	// put back in its image, resident frames included, and an executed job's run is recorded
+	void Finish(PCB& job, Disk& disk, MemManager& mmu);
+	
+	void PrintStatistics();
+};
+
+#endif // RESULT_CACHE_H
@@ -1 +1,225 @@
-#include "scheduler.h"
\ No newline at end of file
+#include "scheduler.h"
+#include <iostream>
+
+namespace scheduler
+{
+
+void Admit(POLICIES policy, std::vector<PCB>& programs, std::deque<PCB*>& ready_queue, ProfileStore& profiles)
+{
+	switch (policy)
+	{
+		case FCFS:
+		{
+			for (int i = 0; i < programs.size(); i++)
+			{
+				ready_queue.push_back(&programs[i]);
+				ready_queue.front()->status = PCB::READY;
+			}
+			
+			break;
+		}
+		
+		case PRIORITY:
+		{
+			PCB* temp[programs.size()];
+			int tempsize = programs.size();
+			
+			for (int i = 0; i < programs.size(); i++)
+			{
+				temp[i] = &programs[i];
+			}
+			
+			int highest_priority_index;
+			
+			while (ready_queue.size() < programs.size())
+			{
+				highest_priority_index = 0;
+				
+				for (int i = 0; i < tempsize; i++)
+				{
+					if (temp[i]->priority > temp[highest_priority_index]->priority)
+					{
+						highest_priority_index = i;
+					}
+				}
+				
+				ready_queue.push_back(temp[highest_priority_index]);
+				temp[highest_priority_index] = temp[tempsize - 1];
+				tempsize--;
+			}
+			
+			break;
+		}
+		
+		case SJF:
+		case SRTF:
+		{
+			PCB* temp[programs.size()];
+			double predicted[programs.size()];
+			int tempsize = programs.size();
+			
+			for (int i = 0; i < programs.size(); i++)
+			{
+				temp[i] = &programs[i];
+				predicted[i] = profiles.PredictBurst(programs[i]);
+			}
+			
+			int shortest_job_index;
+			
+			while (ready_queue.size() < programs.size())
+			{
+				shortest_job_index = 0;
+				
+				for (int i = 0; i < tempsize; i++)
+				{
+					if (predicted[i] < predicted[shortest_job_index])
+					{
+						shortest_job_index = i;
+					}
+				}
+				
+				ready_queue.push_back(temp[shortest_job_index]);
+				temp[shortest_job_index] = temp[tempsize - 1];
+				predicted[shortest_job_index] = predicted[tempsize - 1];
+				tempsize--;
+			}
+			
+			break;
+		}
+	}
+}
+
+PCB* PopShortest(std::deque<PCB*>& queue, ProfileStore& profiles)
+{
+	int shortest_index = 0;
+	double shortest_remaining = profiles.PredictBurst(*queue[0]);
+	
+	for (int i = 1; i < queue.size(); i++)
+	{
+		double remaining = profiles.PredictBurst(*queue[i]);
+		
+		if (remaining < shortest_remaining)
+		{
+			shortest_index = i;
+			shortest_remaining = remaining;
+		}
+	}
+	
+	PCB* shortest = queue[shortest_index];
+	queue.erase(queue.begin() + shortest_index);
+	
+	return shortest;
+}
+
+RunQueues::RunQueues(int num_cpus, unsigned int migration_threshold)
+{
+	queues_.resize(num_cpus);
+	local_resumes_.resize(num_cpus, 0);
+	migrations_in_.resize(num_cpus, 0);
+	
+	migration_threshold_ = migration_threshold;
+}
+
+void RunQueues::Push(PCB* process)
+{
+	int queue_index = process->last_cpu;
+	
+	// never ran, start it on the shortest queue
+	if (queue_index < 0 || queue_index >= queues_.size())
+	{
+		queue_index = 0;
+		
+		for (int i = 1; i < queues_.size(); i++)
+		{
+			if (queues_[i].size() < queues_[queue_index].size())
+			{
+				queue_index = i;
+			}
+		}
+	}
+	
+	queues_[queue_index].push_back(process);
+}
+
+PCB* RunQueues::Take(int queue_index, POLICIES policy, ProfileStore& profiles)
+{
+	if (policy == SRTF)
+	{
+		return PopShortest(queues_[queue_index], profiles);
+	}
+	
+	PCB* process = queues_[queue_index].front();
+	queues_[queue_index].pop_front();
+	
+	return process;
+}
+
+PCB* RunQueues::Pop(int cpu_index, POLICIES policy, ProfileStore& profiles)
+{
+	if (!queues_[cpu_index].empty())
+	{
+		local_resumes_[cpu_index]++;
+		return Take(cpu_index, policy, profiles);
+	}
+	
+	// nothing of our own, look for the most loaded CPU
+	int busiest = -1;
+	
+	for (int i = 0; i < queues_.size(); i++)
+	{
+		if (i != cpu_index && (busiest == -1 || queues_[i].size() > queues_[busiest].size()))
+		{
+			busiest = i;
+		}
+	}
+	
+	// only migrate when the imbalance is worth losing the warm state
+	if (busiest == -1 || queues_[busiest].empty() || queues_[busiest].size() < migration_threshold_)
+	{
+		return NULL;
+	}
+	
+	migrations_in_[cpu_index]++;
+	
+	return Take(busiest, policy, profiles);
+}
+
+double RunQueues::ShortestRemaining(int cpu_index, ProfileStore& profiles)
+{
+	double shortest = -1;
+	
+	for (int i = 0; i < queues_[cpu_index].size(); i++)
+	{
+		double remaining = profiles.PredictBurst(*queues_[cpu_index][i]);
+		
+		if (shortest < 0 || remaining < shortest)
+		{
+			shortest = remaining;
+		}
+	}
+	
+	return shortest;
+}
+
+void RunQueues::PrintStatistics()
+{
+	unsigned long local = 0;
+	unsigned long migrated = 0;
+	
+	std::cout << "Run queue affinity (local resumes / migrations in) per CPU:" << std::endl;
+	
+	for (int i = 0; i < queues_.size(); i++)
+	{
+		std::cout << std::dec << "CPU " << i << ": " << local_resumes_[i] << " / " << migrations_in_[i] << std::endl;
+		
+		local += local_resumes_[i];
+		migrated += migrations_in_[i];
+	}
+	
+	if (local + migrated > 0)
+	{
+		std::cout << "Resume locality: " << 100.0 * local / (local + migrated) << "%" << std::endl;
+	}
+}
+
+}
\ No newline at end of file
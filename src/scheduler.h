@@ -1,11 +1,56 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
+#include <deque>
+#include <vector>
+#include "pcb.h"
+#include "profile_store.h"
+
 namespace scheduler
 {
 
+enum POLICIES {FCFS, PRIORITY, SJF, SRTF};
+
+// LONG-TERM SCHEDULER
+// determines order in which programs are loaded into the ready queue.
+// SJF and SRTF rank jobs by their predicted next CPU burst
+void Admit(POLICIES policy, std::vector<PCB>& programs, std::deque<PCB*>& ready_queue, ProfileStore& profiles);
 
+// takes the process with the shortest predicted next CPU burst out of the queue
+PCB* PopShortest(std::deque<PCB*>& queue, ProfileStore& profiles);
+
+// SHORT-TERM SCHEDULER
+// one run queue per CPU. a process that gives up its CPU queues on the CPU it last ran on,
+// so it resumes where its warm state is. an idle CPU with nothing of its own only pulls
+// work from another CPU's queue when that queue is at least migration_threshold longer
+class RunQueues
+{
+private:
+	std::vector<std::deque<PCB*> > queues_;
+	unsigned int migration_threshold_;
+	
+	// per-CPU statistics
+	std::vector<unsigned long> local_resumes_;
+	std::vector<unsigned long> migrations_in_;
+	
+	PCB* Take(int queue_index, POLICIES policy, ProfileStore& profiles);
+	
+public:
+	RunQueues(int num_cpus, unsigned int migration_threshold);
+	
+	// queues a process on the CPU it last ran on
+	void Push(PCB* process);
+	
+	// next process for the given CPU, NULL if there is none it should take
+	PCB* Pop(int cpu_index, POLICIES policy, ProfileStore& profiles);
+	
+	// shortest predicted next CPU burst among the CPU's own queue, -1 if it is empty
+	double ShortestRemaining(int cpu_index, ProfileStore& profiles);
+	
+	// prints resume locality and migrations per CPU
+	void PrintStatistics();
+};
 
 }
 
-#endif // SCHEDULER_H
\ No newline at end of file
+#endif // SCHEDULER_H
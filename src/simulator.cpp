@@ -0,0 +1,688 @@
+#include "simulator.h"
+#include <algorithm>
+#include <climits>
+#include "address_space.h"
+#include "host_counters.h"
+#include "loader.h"
+#include "metrics.h"
+#include "options.h"
+
+const int PRELOAD_PAGES = 4; // pages loaded when a process is first dispatched
+
+bool Simulator::Event::operator>(const Event& other) const
+{
+	if (time != other.time)
+	{
+		return time > other.time;
+	}
+	
+	if (order != other.order)
+	{
+		return order > other.order;
+	}
+	
+	return sequence > other.sequence;
+}
+
+Simulator::Simulator(Disk& disk, MemManager& mmu, CPU** cpus, int num_cpus, scheduler::POLICIES policy,
+					 std::deque<PCB*>& ready_queue, scheduler::RunQueues& run_queues, ProfileStore& profiles, DiskDevice* disk_device, CompressedSwap* swap, WriteBack& write_back, IoChannels* channels, ResultCache* results, MemoryGroups& groups)
+	: disk_(disk), mmu_(mmu), ready_queue_(ready_queue), run_queues_(run_queues), profiles_(profiles), write_back_(write_back), groups_(groups)
+{
+	cpus_ = cpus;
+	num_cpus_ = num_cpus;
+	policy_ = policy;
+	disk_device_ = disk_device;
+	swap_ = swap;
+	channels_ = channels;
+	results_ = results;
+	
+	sequence_ = 0;
+	now_ = 0;
+	programs_remaining_ = 0;
+	
+	busy_.assign(num_cpus, false);
+	batch_start_.assign(num_cpus, 0);
+	pending_dispatch_.assign(num_cpus, -1);
+	cycles_.assign(num_cpus, 0);
+	
+	pending_disk_ = -1;
+	max_ram_usage_ = 0;
+	events_processed_ = 0;
+	evictions_ = 0;
+	clean_evictions_ = 0;
+}
+
+Simulator::~Simulator()
+{
+	// processes that had not finished are still suspended
+	for (std::map<PCB*, ProcessState>::iterator it = processes_.begin(); it != processes_.end(); it++)
+	{
+		it->second.task.handle.destroy();
+	}
+}
+
+void Simulator::Schedule(int time, int order, EVENT_TYPES type, PCB* process)
+{
+	Event event;
+	event.time = time;
+	event.order = order;
+	event.sequence = sequence_++;
+	event.type = type;
+	event.process = process;
+	
+	events_.push(event);
+}
+
+void Simulator::WakeIdle(int time, int order)
+{
+	for (int i = 0; i < num_cpus_; i++)
+	{
+		if (busy_[i])
+		{
+			continue;
+		}
+		
+		int retry = i > order ? time : time + 1;
+		
+		if (pending_dispatch_[i] < 0 || pending_dispatch_[i] > retry)
+		{
+			pending_dispatch_[i] = retry;
+			Schedule(retry, i, DISPATCH);
+		}
+	}
+}
+
+void Simulator::Dispatch(int cpu_index)
+{
+	// pick an available program/process. resumed processes prefer the CPU they last ran on
+	PCB* next = run_queues_.Pop(cpu_index, policy_, profiles_);
+	
+	if (next == NULL && (next = Admit()) != NULL)
+	{
+		if (next->verified && !options::host_mapped)
+		{
+			// verified jobs run unchecked, so everything they can touch goes in up front
+			for (int i = 0; i < next->footprint.size(); i++)
+			{
+				LoadPage(next, next->footprint[i]);
+			}
+		}
+		else
+		{
+			// load first frames of process into memory
+			for (int i = 0; i < PRELOAD_PAGES && i < FramesNeeded(next); i++)
+			{
+				LoadPage(next, i);
+			}
+		}
+		
+		if (options::host_mapped)
+		{
+			mmu_.CreateAddressSpace(next);
+		}
+	}
+	
+	if (next == NULL)
+	{
+		return; // stays idle until something changes
+	}
+	
+	busy_[cpu_index] = true;
+	processes_[next].cpu = cpu_index;
+	Resume(next, DISPATCH);
+}
+
+PCB* Simulator::Admit()
+{
+	std::vector<std::deque<unsigned int>*> candidates;
+	
+	for (int i = 0; i < group_queues_.size(); i++)
+	{
+		if (group_queues_[i].empty())
+		{
+			continue;
+		}
+		
+		unsigned int first = group_queues_[i].front();
+		PCB* process = ready_queue_[first];
+		
+		if (process->arrival_time > now_)
+		{
+			continue;
+		}
+		
+		// ties keep queue order
+		int position = candidates.size();
+		
+		while (position > 0)
+		{
+			PCB* other = ready_queue_[candidates[position - 1]->front()];
+			
+			if (groups_.Priority(other) > groups_.Priority(process) || (groups_.Priority(other) == groups_.Priority(process) && candidates[position - 1]->front() < first))
+			{
+				break;
+			}
+			
+			position--;
+		}
+		
+		candidates.insert(candidates.begin() + position, &group_queues_[i]);
+	}
+	
+	for (int i = 0; i < candidates.size(); i++)
+	{
+		PCB* process = ready_queue_[candidates[i]->front()];
+		
+		if (groups_.Reserve(process, FramesNeeded(process), now_))
+		{
+			candidates[i]->pop_front();
+			return process;
+		}
+	}
+	
+	return NULL;
+}
+
+void Simulator::StartBatch(int cpu_index)
+{
+	CPU* cpu = cpus_[cpu_index];
+	PCB* process = cpu->GetCurrentProcess();
+	
+	// SRTF is the only preemptive policy, the others run a process until it stops
+	unsigned long budget = policy_ == scheduler::SRTF ? options::quantum : ULONG_MAX;
+	unsigned long cycles = process->cycles;
+	unsigned long instructions = process->instructions;
+	
+	host_counters::PHASES phase = host_counters::Enter(host_counters::EXECUTE);
+	unsigned long ticks = cpu->Run(budget);
+	host_counters::Enter(phase);
+	host_counters::AddGuestInstructions(process->instructions - instructions);
+	
+	cycles_[cpu_index] += process->cycles - cycles;
+	batch_start_[cpu_index] = now_;
+	
+	// a retired instruction takes a cycle, the rest is memory latency from the cache model. the
+	// CPU stalls for it, so the batch ends that much later
+	ticks += (process->cycles - cycles) - (process->instructions - instructions);
+	
+	if (process->status == PCB::RUNNING)
+	{
+		Schedule(now_ + ticks, cpu_index, QUANTUM_EXPIRY);
+	}
+	else
+	{
+		Schedule(now_ + ticks - 1, cpu_index, CPU_STOP);
+	}
+}
+
+Simulator::Task Simulator::Lifetime(PCB* process)
+{
+	ProcessState& state = processes_[process];
+	
+	co_await Wait(state); // ARRIVAL
+	process->ready_since = now_;
+	WakeIdle(now_, -1);
+	
+	while (true)
+	{
+		co_await Wait(state); // DISPATCH, onto state.cpu
+		int cpu_index = state.cpu;
+		
+		cpus_[cpu_index]->SetCurrentProcess(process);
+		process->cpu_id = cpu_index;
+		process->last_cpu = cpu_index;
+		process->wait_time += now_ - process->ready_since;
+		
+		// batches until the process blocks, terminates or is preempted
+		while (process->cpu_id != -1)
+		{
+			StartBatch(cpu_index);
+			
+			if (co_await Wait(state) == QUANTUM_EXPIRY)
+			{
+				process->completion_time += now_ - batch_start_[cpu_index];
+				
+				// SRTF: a process waiting on this CPU predicted to end its burst sooner takes it
+				double shortest = policy_ == scheduler::SRTF ? run_queues_.ShortestRemaining(cpu_index, profiles_) : -1;
+				
+				if (shortest >= 0 && shortest < profiles_.PredictBurst(*process))
+				{
+					process->status = PCB::WAITING;
+					process->cpu_id = -1;
+					process->ready_since = now_;
+					profiles_.RecordBurst(*process);
+					run_queues_.Push(process);
+				}
+				
+				continue;
+			}
+			
+			// CPU_STOP, on the instruction at now_
+			process->completion_time += now_ - batch_start_[cpu_index] + 1;
+			process->cpu_id = -1;
+			
+			// a host mapping only covers 16 bit addresses
+			if (process->status == PCB::BLOCKED && process->address_space != NULL && process->page_fault_index >= AddressSpace::GUEST_PAGES)
+			{
+				mmu_.DestroyAddressSpace(process);
+			}
+			
+			// pages past the image are held until exit, each needs a frame nobody else has reserved
+			if (process->status == PCB::BLOCKED && !process->InImage(process->page_fault_index) && !groups_.Reserve(process, 1, now_))
+			{
+				process->status = PCB::TERMINATED;
+				std::cout << "OUT OF MEMORY" << std::endl;
+			}
+			
+			if (process->status == PCB::TERMINATED)
+			{
+				WriteBackProcess(process); // leaves the results in the disk image
+				
+				// a streaming job runs again from the start on its next record
+				if (channels_ != NULL && channels_->HandOff(process))
+				{
+					process->program_counter = 0;
+					process->registers.fill(0);
+					process->status = PCB::WAITING;
+					process->ready_since = now_;
+					profiles_.RecordBurst(*process);
+					run_queues_.Push(process);
+					continue;
+				}
+				
+				if (results_ != NULL)
+				{
+					results_->Finish(*process, disk_, mmu_);
+				}
+				
+				mmu_.PrintFrames(process, disk_);
+				
+				programs_remaining_--;
+				process->finish_time = now_ + 1;
+				profiles_.RecordBurst(*process);
+				profiles_.RecordRun(*process);
+				mmu_.Release(process->page_table);
+				groups_.Unreserve(process, FramesNeeded(process) + process->anonymous_pages, now_);
+				
+				if (process->address_space != NULL)
+				{
+					mmu_.DestroyAddressSpace(process);
+				}
+				
+				co_return;
+			}
+			
+			// service page fault
+			process->status = PCB::WAITING;
+			process->ready_since = now_;
+			profiles_.RecordBurst(*process);
+			
+			if (!PageIn(process))
+			{
+				co_await Wait(state); // DISK_COMPLETION, the page is loaded
+			}
+			
+			run_queues_.Push(process);
+		}
+	}
+}
+
+void Simulator::Resume(PCB* process, EVENT_TYPES event)
+{
+	ProcessState& state = processes_[process];
+	state.woken_by = event;
+	state.waiting.resume();
+}
+
+bool Simulator::PageIn(PCB* process)
+{
+	// pages held compressed in memory or past the image come back without touching the disk
+	if (disk_device_ == NULL || (swap_ != NULL && swap_->Contains(process, process->page_fault_index)) || !process->InImage(process->page_fault_index))
+	{
+		LoadPage(process, process->page_fault_index);
+		return true;
+	}
+	
+	// wait on the disk, the page is loaded when the request completes
+	IoRequest request;
+	request.process = process;
+	request.page_num = process->page_fault_index;
+	request.disk_address = process->disk_address + (process->page_fault_index << Machine::FRAME_SHIFT);
+	request.size = Machine::FRAME_SIZE;
+	request.write = false;
+	
+	// a queued write-back of the page goes first
+	if (write_back_.Holds(process, process->page_fault_index))
+	{
+		FlushWriteBack();
+	}
+	
+	disk_device_->Submit(request, now_);
+	KickDisk();
+	
+	return false;
+}
+
+void Simulator::LoadPage(PCB* process, uint32_t page_num)
+{
+	host_counters::PHASES phase = host_counters::Enter(host_counters::PAGE_IN);
+	
+	// zero filled and never evicted, its frame was reserved when it faulted
+	if (!process->InImage(page_num))
+	{
+		loader::LoadPageToMemory(disk_, mmu_, process, page_num);
+		host_counters::Enter(phase);
+		return;
+	}
+	
+	if (FramesNeeded(process) < Machine::PagesFor(process->program_size) && process->resident_pages.size() >= FramesNeeded(process))
+	{
+		EvictPage(process);
+	}
+	
+	types::Word words[Machine::FRAME_WORDS];
+	bool dirty = false;
+	
+	if (process->paged_out[page_num] && swap_ != NULL && swap_->Load(process, page_num, words, dirty))
+	{
+		loader::LoadWordsToMemory(mmu_, process, page_num, words);
+	}
+	else
+	{
+		// the disk image has to be current before it is read
+		if (write_back_.Holds(process, page_num))
+		{
+			FlushWriteBack();
+		}
+		
+		loader::LoadPageToMemory(disk_, mmu_, process, page_num);
+	}
+	
+	process->resident_pages.push_back(page_num);
+	process->paged_out[page_num] = false;
+	process->dirty_pages[page_num] = dirty;
+	
+	host_counters::Enter(phase);
+}
+
+void Simulator::EvictPage(PCB* process)
+{
+	uint32_t victim = process->resident_pages.front();
+	process->resident_pages.pop_front();
+	
+	types::Word words[Machine::FRAME_WORDS];
+	loader::ReadPageFromMemory(mmu_, process, victim, words);
+	
+	if (swap_ != NULL)
+	{
+		swap_->Store(process, victim, words, process->dirty_pages[victim]);
+	}
+	else if (process->dirty_pages[victim])
+	{
+		write_back_.Add(process, victim, words);
+	}
+	
+	if (!process->dirty_pages[victim])
+	{
+		clean_evictions_++;
+	}
+	
+	mmu_.UnmapPage(process, victim);
+	process->paged_out[victim] = true;
+	process->dirty_pages[victim] = false;
+	evictions_++;
+	groups_.CountEviction(process);
+	
+	if (write_back_.Full())
+	{
+		FlushWriteBack();
+	}
+}
+
+void Simulator::WriteBackProcess(PCB* process)
+{
+	// paging traffic either way, so it is charged with page-ins
+	host_counters::PHASES phase = host_counters::Enter(host_counters::PAGE_IN);
+	
+	if (swap_ != NULL)
+	{
+		swap_->Flush(process);
+	}
+	
+	for (int i = 0; i < process->resident_pages.size(); i++)
+	{
+		uint32_t page_num = process->resident_pages[i];
+		
+		if (process->dirty_pages[page_num])
+		{
+			types::Word words[Machine::FRAME_WORDS];
+			loader::ReadPageFromMemory(mmu_, process, page_num, words);
+			
+			write_back_.Add(process, page_num, words);
+			process->dirty_pages[page_num] = false;
+		}
+	}
+	
+	FlushWriteBack();
+	
+	host_counters::Enter(phase);
+}
+
+void Simulator::FlushWriteBack()
+{
+	std::vector<IoRequest> transfers = write_back_.Flush();
+	
+	if (disk_device_ == NULL)
+	{
+		return;
+	}
+	
+	for (int i = 0; i < transfers.size(); i++)
+	{
+		disk_device_->Submit(transfers[i], now_);
+	}
+	
+	KickDisk();
+}
+
+void Simulator::KickDisk()
+{
+	// an idle disk picks new requests up on the next tick
+	if (pending_disk_ < 0 && !disk_device_->Idle())
+	{
+		pending_disk_ = now_ + 1;
+		Schedule(pending_disk_, -1, DISK_COMPLETION);
+	}
+}
+
+unsigned int Simulator::FramesNeeded(PCB* process)
+{
+	unsigned int pages = Machine::PagesFor(process->program_size);
+	unsigned int limit = options::resident_limit;
+	unsigned int quota = groups_.Quota(process);
+	
+	// a process in a group pages within the group's quota
+	if (quota > 0 && (limit == 0 || quota < limit))
+	{
+		limit = quota;
+	}
+	
+	if (limit == 0 || process->verified || pages <= std::max(limit, process->min_frames))
+	{
+		return pages;
+	}
+	
+	return std::max(limit, process->min_frames); // below it the job could never make progress
+}
+
+void Simulator::DiskCompletion()
+{
+	pending_disk_ = -1;
+	
+	// finished page-ins make their processes runnable again
+	std::vector<IoRequest> completed = disk_device_->Complete(now_);
+	
+	for (int i = 0; i < completed.size(); i++)
+	{
+		if (!completed[i].write)
+		{
+			LoadPage(completed[i].process, completed[i].page_num);
+			Resume(completed[i].process, DISK_COMPLETION);
+		}
+	}
+	
+	if (disk_device_->BusyUntil() >= 0)
+	{
+		pending_disk_ = std::max(disk_device_->BusyUntil(), now_ + 1);
+		Schedule(pending_disk_, -1, DISK_COMPLETION);
+	}
+	
+	if (!completed.empty())
+	{
+		WakeIdle(now_, -1);
+	}
+}
+
+void Simulator::SampleRamUsage()
+{
+	if (mmu_.PercentageUsed() > max_ram_usage_)
+	{
+		max_ram_usage_ = mmu_.PercentageUsed();
+	}
+}
+
+void Simulator::Run(std::vector<PCB>& programs, int num_programs)
+{
+	programs_remaining_ = num_programs;
+	group_queues_.assign(groups_.Count(), std::deque<unsigned int>());
+	
+	for (int i = 0; i < ready_queue_.size(); i++)
+	{
+		group_queues_[ready_queue_[i]->memory_group].push_back(i);
+		processes_[ready_queue_[i]].task = Lifetime(ready_queue_[i]);
+		Schedule(ready_queue_[i]->arrival_time, -1, ARRIVAL, ready_queue_[i]);
+	}
+	
+	// the tick the last program finishes in still runs to its end
+	while (!events_.empty() && (programs_remaining_ > 0 || events_.top().time == now_))
+	{
+		Event event = events_.top();
+		events_.pop();
+		
+		// memory use is sampled at the end of every tick
+		if (event.time > now_)
+		{
+			SampleRamUsage();
+			now_ = event.time;
+			metrics::time = now_;
+		}
+		
+		events_processed_++;
+		
+		switch (event.type)
+		{
+			case ARRIVAL:
+			{
+				Resume(event.process, ARRIVAL);
+				break;
+			}
+			
+			case DISK_COMPLETION:
+			{
+				if (event.time == pending_disk_)
+				{
+					DiskCompletion();
+				}
+				
+				break;
+			}
+			
+			case DISPATCH:
+			{
+				// superseded by an earlier retry
+				if (event.time != pending_dispatch_[event.order])
+				{
+					break;
+				}
+				
+				pending_dispatch_[event.order] = -1;
+				
+				if (!busy_[event.order])
+				{
+					Dispatch(event.order);
+				}
+				
+				break;
+			}
+			
+			case CPU_STOP:
+			case QUANTUM_EXPIRY:
+			{
+				PCB* process = cpus_[event.order]->GetCurrentProcess();
+				Resume(process, event.type);
+				
+				// the process left the CPU, blocked, terminated or preempted
+				if (process->cpu_id == -1)
+				{
+					busy_[event.order] = false;
+					
+					// a preempted process' successor takes over in the same tick
+					if (event.type == QUANTUM_EXPIRY)
+					{
+						Dispatch(event.order);
+					}
+					
+					WakeIdle(now_, event.order);
+				}
+				
+				break;
+			}
+		}
+	}
+	
+	SampleRamUsage();
+	now_++;
+	metrics::time = now_;
+	
+	// close the books on whatever had not finished
+	for (int i = 0; i < num_cpus_; i++)
+	{
+		if (busy_[i])
+		{
+			cpus_[i]->GetCurrentProcess()->completion_time += now_ - batch_start_[i];
+		}
+	}
+	
+	for (int i = 0; i < programs.size(); i++)
+	{
+		if (programs[i].finish_time < 0 && programs[i].cpu_id == -1)
+		{
+			programs[i].wait_time += now_ - programs[i].ready_since;
+		}
+	}
+}
+
+float Simulator::MaxRamUsage()
+{
+	return max_ram_usage_;
+}
+
+unsigned long Simulator::CpuCycles(int cpu_index)
+{
+	return cycles_[cpu_index];
+}
+
+unsigned long Simulator::EventsProcessed()
+{
+	return events_processed_;
+}
+
+unsigned long Simulator::Evictions()
+{
+	return evictions_;
+}
+
+unsigned long Simulator::CleanEvictions()
+{
+	return clean_evictions_;
+}
@@ -0,0 +1,182 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <queue>
+#include <vector>
+#include "compressed_swap.h"
+#include "cpu.h"
+#include "disk.h"
+#include "disk_model.h"
+#include "io_channels.h"
+#include "memory_groups.h"
+#include "memory_manager.h"
+#include "pcb.h"
+#include "profile_store.h"
+#include "result_cache.h"
+#include "scheduler.h"
+#include "write_back.h"
+
+// discrete-event core of the machine. time jumps from one timed event to the next and a CPU
+// runs a whole batch of instructions at once, up to the point its process blocks, terminates
+// or its quantum expires. waiting is accounted from the timestamps of state transitions, so
+// the cost of a step does not depend on how many jobs are waiting.
+// events at the same tick run devices first and then CPUs by index, the order the CPUs were
+// stepped in when every tick was simulated.
+// each process is a coroutine that waits for its arrival, a CPU, the end of its batch and its
+// page-ins, and the event that ends the wait resumes it
+class Simulator
+{
+public:
+	enum EVENT_TYPES {ARRIVAL, DISK_COMPLETION, DISPATCH, CPU_STOP, QUANTUM_EXPIRY};
+
+private:
+	struct Event
+	{
+		int time;
+		int order; // -1 for devices and arrivals, the CPU index otherwise
+		unsigned long sequence; // first scheduled first among equal time and order
+		EVENT_TYPES type;
+		PCB* process; // ARRIVAL
+		
+		bool operator>(const Event& other) const;
+	};
+	
+	Disk& disk_;
+	MemManager& mmu_;
+	CPU** cpus_;
+	int num_cpus_;
+	scheduler::POLICIES policy_;
+	std::deque<PCB*>& ready_queue_; // in admission order, left as it is
+	std::vector<std::deque<unsigned int> > group_queues_; // per memory group, ready queue positions not admitted yet
+	scheduler::RunQueues& run_queues_;
+	ProfileStore& profiles_;
+	DiskDevice* disk_device_; // NULL serves page-ins instantly
+	CompressedSwap* swap_; // NULL sends evicted dirty pages straight to write-back
+	IoChannels* channels_; // NULL when no job streams through host files
+	ResultCache* results_; // NULL when runs are not memoized
+	WriteBack& write_back_;
+	MemoryGroups& groups_;
+	
+	// a process' coroutine. it runs until its first wait when it is created, and stays
+	// suspended once it has finished so it can be destroyed with the simulator
+	struct Task
+	{
+		struct promise_type
+		{
+			Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() {}
+			void unhandled_exception() { std::terminate(); }
+		};
+		
+		std::coroutine_handle<promise_type> handle;
+	};
+	
+	struct ProcessState
+	{
+		Task task;
+		std::coroutine_handle<> waiting; // where the coroutine is suspended
+		EVENT_TYPES woken_by;
+		int cpu; // the CPU a DISPATCH gave it
+	};
+	
+	// suspends a process until Resume, and gives it the event that woke it
+	struct Wait
+	{
+		ProcessState& state;
+		
+		Wait(ProcessState& state) : state(state) {}
+		bool await_ready() { return false; }
+		void await_suspend(std::coroutine_handle<> handle) { state.waiting = handle; }
+		EVENT_TYPES await_resume() { return state.woken_by; }
+	};
+	
+	std::map<PCB*, ProcessState> processes_;
+	
+	std::priority_queue<Event, std::vector<Event>, std::greater<Event> > events_;
+	unsigned long sequence_;
+	int now_;
+	int programs_remaining_;
+	
+	// per CPU
+	std::vector<bool> busy_;
+	std::vector<int> batch_start_; // when the running batch started
+	std::vector<int> pending_dispatch_; // time of the DISPATCH event an idle CPU waits for, -1 if none
+	std::vector<unsigned long> cycles_;
+	
+	int pending_disk_; // time of the next DISK_COMPLETION, -1 if none
+	float max_ram_usage_;
+	unsigned long events_processed_;
+	unsigned long evictions_;
+	unsigned long clean_evictions_; // dropped without being written
+	
+	void Schedule(int time, int order, EVENT_TYPES type, PCB* process = NULL);
+	
+	// lets idle CPUs retry at their first turn after the state change at (time, order)
+	void WakeIdle(int time, int order);
+	
+	// picks a process for an idle CPU and resumes it there
+	void Dispatch(int cpu_index);
+	
+	// takes the next process to admit off its group's queue once its frames are reserved, NULL if
+	// none can be. each memory group's first process is a candidate once it has arrived, in group
+	// priority order and then ready queue order, so a group whose next job does not fit does not
+	// hold up the others
+	PCB* Admit();
+	
+	// runs the CPU's process until it stops or its quantum expires, and schedules that event
+	void StartBatch(int cpu_index);
+	
+	// a process from arrival to termination. it gives up its CPU when it blocks or terminates,
+	// or when SRTF finds a shorter queued process at the end of a quantum
+	Task Lifetime(PCB* process);
+	
+	void Resume(PCB* process, EVENT_TYPES event);
+	
+	// queues a read for the faulting page and returns false, or loads the page right away
+	bool PageIn(PCB* process);
+	
+	// brings a page in from the swap tier or the disk image, evicting the process' oldest
+	// resident page first if it is at its resident limit
+	void LoadPage(PCB* process, uint32_t page_num);
+	void EvictPage(PCB* process);
+	
+	// puts a finished process' dirty pages back in its disk image
+	void WriteBackProcess(PCB* process);
+	
+	// writes out the queued dirty pages, timed by the disk model if there is one
+	void FlushWriteBack();
+	
+	// schedules the disk to pick up queued requests
+	void KickDisk();
+	
+	// frames promised to a process at admission, at most its resident limit or its group's quota.
+	// verified jobs run unchecked, so they are never evicted
+	unsigned int FramesNeeded(PCB* process);
+	
+	void DiskCompletion();
+	
+	void SampleRamUsage();
+
+public:
+	Simulator(Disk& disk, MemManager& mmu, CPU** cpus, int num_cpus, scheduler::POLICIES policy,
+			  std::deque<PCB*>& ready_queue, scheduler::RunQueues& run_queues, ProfileStore& profiles, DiskDevice* disk_device, CompressedSwap* swap, WriteBack& write_back, IoChannels* channels, ResultCache* results, MemoryGroups& groups);
+	~Simulator();
+	
+	// runs until num_programs jobs have terminated
+	void Run(std::vector<PCB>& programs, int num_programs);
+	
+	float MaxRamUsage();
+	unsigned long CpuCycles(int cpu_index); // busy cycles
+	unsigned long EventsProcessed();
+	unsigned long Evictions();
+	unsigned long CleanEvictions();
+};
+
+#endif // SIMULATOR_H
@@ -0,0 +1,408 @@
+#include "translator.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include "isa.h"
+#include "machine_config.h"
+
+namespace translator
+{
+
+static std::string Hex(uint32_t value)
+{
+	char text[16];
+	snprintf(text, sizeof(text), "0x%04X", value);
+	return text;
+}
+
+static std::string Label(uint32_t pc)
+{
+	char text[16];
+	snprintf(text, sizeof(text), "at_%04X", pc);
+	return text;
+}
+
+static std::string Reg(uint8_t reg)
+{
+	return "r[" + std::to_string(reg) + "]";
+}
+
+// one translated job, emitting statements at an indentation
+class JobWriter
+{
+private:
+	std::ostream& out_;
+	uint32_t code_size_;
+	std::string indent_;
+	
+	bool InCode(uint32_t pc)
+	{
+		return pc < code_size_ && pc % sizeof(types::Word) == 0;
+	}
+	
+	void Line(std::string text)
+	{
+		out_ << indent_ << text << std::endl;
+	}
+	
+	void Open(std::string condition)
+	{
+		Line("if (" + condition + ")");
+		Line("{");
+		indent_ += "\t";
+	}
+	
+	void Close()
+	{
+		indent_.erase(indent_.size() - 1);
+		Line("}");
+	}
+	
+	// the code at pc is fetched again, after control came from another page
+	void Fetch(uint32_t pc)
+	{
+		Open("!native::Resident(context, " + Hex(pc) + ")");
+		Line("return native::Fault(context, " + Hex(pc) + ", " + Hex(pc) + ");");
+		Close();
+	}
+	
+	// retires the instruction at pc and goes on at target
+	void Continue(uint32_t pc, uint32_t target, bool fall_through)
+	{
+		Open("native::Retire(context, budget)");
+		Line("return native::Exit(context, " + Hex(target) + ", native::BUDGET);");
+		Close();
+		
+		if (!InCode(target))
+		{
+			Line("return native::Exit(context, " + Hex(target) + ", native::INTERPRET);");
+			return;
+		}
+		
+		if (Machine::PageOf(target) != Machine::PageOf(pc))
+		{
+			Fetch(target);
+		}
+		
+		if (!fall_through)
+		{
+			Line("goto " + Label(target) + ";");
+		}
+	}
+	
+	// a load or store of the address already in the address variable
+	void Access(uint32_t pc, std::string call)
+	{
+		Open("!" + call);
+		Line("return native::Fault(context, " + Hex(pc) + ", address);");
+		Close();
+	}
+	
+	void Branch(uint32_t pc, std::string condition, uint32_t target)
+	{
+		Open(condition);
+		Continue(pc, target, false);
+		Close();
+		
+		Continue(pc, pc + sizeof(types::Word), true);
+	}
+
+public:
+	JobWriter(std::ostream& out, uint32_t code_size) : out_(out), code_size_(code_size), indent_("\t")
+	{
+	}
+	
+	void Instruction(uint32_t pc, types::Word word)
+	{
+		const isa::Instruction instruction = isa::Decode(word);
+		uint32_t next = pc + sizeof(types::Word);
+		std::string imm = Hex(instruction.address);
+		
+		if (pc > 0)
+		{
+			out_ << "\t" << std::endl;
+		}
+		
+		out_ << Label(pc) << ": // " << isa::Disassemble(word) << std::endl;
+		
+		switch (instruction.opcode)
+		{
+			case isa::RD:
+			{
+				Line("process.io_ops++;");
+				Line(std::string("address = ") + (instruction.reg2 > 0 ? "(uint16_t)" + Reg(instruction.reg2) : imm) + ";");
+				Access(pc, "native::Load(context, address, word)");
+				Line(Reg(instruction.reg1) + " = word;");
+				break;
+			}
+			
+			case isa::WR:
+			case isa::ST:
+			{
+				std::string value = Reg(instruction.reg1);
+				
+				if (instruction.opcode == isa::WR)
+				{
+					Line("process.io_ops++;");
+					Line("address = " + (instruction.address == 0 ? Reg(instruction.reg2) : imm) + ";");
+				}
+				else
+				{
+					Line("address = " + imm + " + " + Reg(instruction.reg2) + ";");
+				}
+				
+				Access(pc, "native::Store(context, address, " + value + ")");
+				
+				Open("native::Written(context, address)");
+				Line("native::Retire(context, budget);");
+				Line("return native::Exit(context, " + Hex(next) + ", native::CODE_WRITTEN);");
+				Close();
+				break;
+			}
+			
+			case isa::LW:
+			{
+				Line("address = " + imm + " + " + Reg(instruction.reg1) + ";");
+				Access(pc, "native::Load(context, address, word)");
+				Line(Reg(instruction.reg2) + " = word;");
+				break;
+			}
+			
+			case isa::MOV:
+			{
+				Line(Reg(instruction.reg1) + " = " + Reg(instruction.reg2) + ";");
+				break;
+			}
+			
+			case isa::ADD:
+			case isa::SUB:
+			case isa::MUL:
+			case isa::AND:
+			case isa::OR:
+			{
+				const char* operators[] = {" + ", " - ", " * ", "", " & ", " | "};
+				Line(Reg(instruction.reg3) + " = " + Reg(instruction.reg1) + operators[instruction.opcode - isa::ADD] + Reg(instruction.reg2) + ";");
+				break;
+			}
+			
+			case isa::DIV:
+			{
+				Open(Reg(instruction.reg2) + " == 0");
+				Line("return native::DivideByZero(context, " + Hex(pc) + ");");
+				Close();
+				Line(Reg(instruction.reg3) + " = " + Reg(instruction.reg1) + " / " + Reg(instruction.reg2) + ";");
+				break;
+			}
+			
+			case isa::MOVI:
+			case isa::LDI:
+			{
+				Line(Reg(instruction.reg2) + " = " + imm + ";");
+				break;
+			}
+			
+			case isa::ADDI:
+			{
+				Line(Reg(instruction.reg2) + " += " + imm + ";");
+				break;
+			}
+			
+			case isa::MULI:
+			{
+				Line(Reg(instruction.reg2) + " *= " + imm + ";");
+				break;
+			}
+			
+			case isa::DIVI:
+			{
+				if (instruction.address == 0)
+				{
+					Line("return native::DivideByZero(context, " + Hex(pc) + ");");
+					return;
+				}
+				
+				Line(Reg(instruction.reg2) + " /= " + imm + ";");
+				break;
+			}
+			
+			case isa::SLT:
+			{
+				Line(Reg(instruction.reg3) + " = " + Reg(instruction.reg1) + " < " + Reg(instruction.reg2) + " ? 1 : 0;");
+				break;
+			}
+			
+			case isa::SLTI:
+			{
+				Line(Reg(instruction.reg2) + " = " + Reg(instruction.reg1) + " < " + imm + " ? 1 : 0;");
+				break;
+			}
+			
+			case isa::HLT:
+			{
+				Line("return native::Halt(context, " + Hex(pc) + ");");
+				return;
+			}
+			
+			case isa::JMP:
+			{
+				Continue(pc, instruction.address, false);
+				return;
+			}
+			
+			// the sign tests are on bit 31, as in the interpreter
+			case isa::BEQ: Branch(pc, Reg(instruction.reg1) + " == " + Reg(instruction.reg2), instruction.address); return;
+			case isa::BNE: Branch(pc, Reg(instruction.reg1) + " != " + Reg(instruction.reg2), instruction.address); return;
+			case isa::BEZ: Branch(pc, Reg(instruction.reg1) + " == 0", instruction.address); return;
+			case isa::BNZ: Branch(pc, Reg(instruction.reg1) + " != 0", instruction.address); return;
+			case isa::BGZ: Branch(pc, "!(" + Reg(instruction.reg1) + " & 0x80000000)", instruction.address); return;
+			case isa::BLZ: Branch(pc, Reg(instruction.reg1) + " & 0x80000000", instruction.address); return;
+			
+			case isa::LUI:
+			{
+				Line(Reg(instruction.reg2) + " = (types::Word)" + imm + " << 16;");
+				break;
+			}
+			
+			case isa::CSWP:
+			{
+				Line("address = " + imm + " + " + Reg(instruction.reg1) + ";");
+				Access(pc, "native::Load(context, address, word)");
+				
+				Open("!native::Load(context, address + 4, " + Reg(instruction.reg2) + ")");
+				Line("return native::Fault(context, " + Hex(pc) + ", address + 4);");
+				Close();
+				
+				Open("word > " + Reg(instruction.reg2));
+				Line("native::Store(context, address, " + Reg(instruction.reg2) + ");");
+				Line("native::Store(context, address + 4, word);");
+				Line(Reg(instruction.reg2) + " = 1;");
+				
+				Open("native::Written(context, address) | native::Written(context, address + 4)");
+				Line("native::Retire(context, budget);");
+				Line("return native::Exit(context, " + Hex(next) + ", native::CODE_WRITTEN);");
+				Close();
+				
+				Close();
+				Line("else");
+				Line("{");
+				Line("\t" + Reg(instruction.reg2) + " = 0;");
+				Line("}");
+				break;
+			}
+			
+			default:
+			{
+				// the block instructions run their kernels in the interpreter
+				if (isa::OPCODE_TABLE[instruction.opcode].block)
+				{
+					Line("return native::Exit(context, " + Hex(pc) + ", native::INTERPRET);");
+					return;
+				}
+				
+				break; // NOP and unused opcodes do nothing
+			}
+		}
+		
+		Continue(pc, next, true);
+	}
+};
+
+bool Translate(Disk& disk, std::vector<PCB>& jobs, std::string path)
+{
+	std::ofstream out(path.c_str());
+	
+	if (!out.is_open())
+	{
+		std::cout << "Could not write " << path << std::endl;
+		return false;
+	}
+	
+	out << "// precompiled job library, generated by vm --translate from the deck. do not edit" << std::endl;
+	out << "#include \"native_runtime.h\"" << std::endl << std::endl;
+	
+	std::map<uint64_t, std::string> functions; // by content hash
+	std::vector<const PCB*> translated;
+	std::set<std::string> names;
+	
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		const PCB& job = jobs[i];
+		
+		if (functions.count(job.content_hash) != 0)
+		{
+			continue;
+		}
+		
+		std::string name = "Job" + std::to_string(job.id);
+		
+		if (names.count(name) != 0) // ids repeat in some decks
+		{
+			name += "_" + std::to_string(i);
+		}
+		
+		names.insert(name);
+		functions[job.content_hash] = name;
+		translated.push_back(&job);
+		
+		uint32_t code_size = job.input_buffer_offset;
+		
+		out << "// job " << job.id << ", " << code_size / sizeof(types::Word) << " code words" << std::endl;
+		out << "static int " << name << "(native::Context& context, unsigned long budget)" << std::endl;
+		out << "{" << std::endl;
+		out << "\tPCB& process = *context.process;" << std::endl;
+		out << "\ttypes::Word* r = process.registers.data();" << std::endl;
+		out << "\tuint32_t address;" << std::endl;
+		out << "\ttypes::Word word;" << std::endl;
+		out << "\t" << std::endl;
+		out << "\tif (!native::Resident(context, process.program_counter))" << std::endl;
+		out << "\t{" << std::endl;
+		out << "\t\treturn native::Fault(context, process.program_counter, process.program_counter);" << std::endl;
+		out << "\t}" << std::endl;
+		out << "\t" << std::endl;
+		out << "\tswitch (process.program_counter)" << std::endl;
+		out << "\t{" << std::endl;
+		
+		for (uint32_t pc = 0; pc < code_size; pc += sizeof(types::Word))
+		{
+			out << "\t\tcase " << Hex(pc) << ": goto " << Label(pc) << ";" << std::endl;
+		}
+		
+		out << "\t\tdefault: return native::Exit(context, process.program_counter, native::INTERPRET);" << std::endl;
+		out << "\t}" << std::endl;
+		out << "\t" << std::endl;
+		
+		JobWriter writer(out, code_size);
+		
+		for (uint32_t pc = 0; pc < code_size; pc += sizeof(types::Word))
+		{
+			types::Word word;
+			disk.Read(job.disk_address + pc, &word, sizeof(word));
+			
+			writer.Instruction(pc, word);
+		}
+		
+		out << "}" << std::endl << std::endl;
+	}
+	
+	out << "const native::Translation native::LIBRARY[] =" << std::endl;
+	out << "{" << std::endl;
+	
+	for (int i = 0; i < translated.size(); i++)
+	{
+		char hash[24];
+		snprintf(hash, sizeof(hash), "0x%016llX", (unsigned long long)translated[i]->content_hash);
+		
+		out << "\t{" << hash << "ull, " << translated[i]->id << ", " << functions[translated[i]->content_hash] << "}," << std::endl;
+	}
+	
+	out << "\t{0, 0, NULL}" << std::endl;
+	out << "};" << std::endl;
+	
+	std::cout << "Translated " << translated.size() << " jobs to " << path << std::endl;
+	
+	return out.good();
+}
+
+}
@@ -0,0 +1,18 @@
+#ifndef TRANSLATOR_H
+#define TRANSLATOR_H
+
+#include <string>
+#include <vector>
+#include "disk.h"
+#include "pcb.h"
+
+// ahead of time translation of a deck into the precompiled job library
+namespace translator
+{
+// writes every job's code as a C++ function to the file, with the native::LIBRARY table that
+// finds them by content hash. each guest instruction gets a label the entry switch and the
+// branches go to. jobs with the same image share a function. returns false if the file could not be written
+bool Translate(Disk& disk, std::vector<PCB>& jobs, std::string path);
+}
+
+#endif // TRANSLATOR_H
@@ -0,0 +1,399 @@
+#include "verifier.h"
+#include "isa.h"
+#include "types.h"
+#include <algorithm>
+#include <set>
+#include <sstream>
+
+namespace verifier
+{
+
+const uint64_t WORD_MAX = 0xFFFFFFFF;
+const int WIDEN_AFTER = 3; // visits of an instruction before its bounds are widened
+
+// unsigned range of values a register can hold
+struct Interval
+{
+	uint64_t lo;
+	uint64_t hi;
+};
+
+static Interval Constant(uint64_t value)
+{
+	Interval interval = {value, value};
+	return interval;
+}
+
+static Interval Top()
+{
+	Interval interval = {0, WORD_MAX};
+	return interval;
+}
+
+static bool IsTop(Interval interval)
+{
+	return interval.lo == 0 && interval.hi == WORD_MAX;
+}
+
+// results that can leave the 32 bit range wrap around, so they could be anything
+static Interval Checked(uint64_t lo, uint64_t hi)
+{
+	if (hi > WORD_MAX)
+	{
+		return Top();
+	}
+	
+	Interval interval = {lo, hi};
+	return interval;
+}
+
+static Interval Truncate16(Interval interval)
+{
+	if (interval.hi > 0xFFFF)
+	{
+		return Checked(0, 0xFFFF);
+	}
+	
+	return interval;
+}
+
+// smallest all-ones value covering the bound, the most an OR can produce
+static uint64_t BitCeiling(uint64_t value)
+{
+	uint64_t ceiling = 0;
+	
+	while (ceiling < value)
+	{
+		ceiling = (ceiling << 1) | 1;
+	}
+	
+	return ceiling;
+}
+
+typedef std::array<Interval, Machine::REGISTER_COUNT> State;
+
+// joins new_state into state. returns true if state changed
+static bool Join(State& state, const State& new_state, bool widen)
+{
+	bool changed = false;
+	
+	for (int i = 0; i < Machine::REGISTER_COUNT; i++)
+	{
+		Interval joined = {std::min(state[i].lo, new_state[i].lo), std::max(state[i].hi, new_state[i].hi)};
+		
+		if (widen)
+		{
+			// bounds still moving after a few passes round a loop go straight to their limit
+			if (joined.lo < state[i].lo)
+			{
+				joined.lo = 0;
+			}
+			
+			if (joined.hi > state[i].hi)
+			{
+				joined.hi = WORD_MAX;
+			}
+		}
+		
+		if (joined.lo != state[i].lo || joined.hi != state[i].hi)
+		{
+			state[i] = joined;
+			changed = true;
+		}
+	}
+	
+	return changed;
+}
+
+Report Verify(Disk& disk, PCB& job)
+{
+	Report report;
+	report.verified = false;
+	report.control_flow = false;
+	
+	uint32_t code_size = job.input_buffer_offset;
+	unsigned int num_instructions = code_size / sizeof(types::Word);
+	
+	if (num_instructions == 0 || job.program_size < sizeof(types::Word))
+	{
+		report.reason = "no code";
+		return report;
+	}
+	
+	uint32_t last_word = job.program_size - sizeof(types::Word); // highest address a word access may use
+	
+	std::vector<types::Word> code(num_instructions);
+	
+	for (unsigned int i = 0; i < num_instructions; i++)
+	{
+		disk.Read(job.disk_address + i * sizeof(types::Word), &code[i], sizeof(types::Word));
+	}
+	
+	std::vector<State> states(num_instructions);
+	std::vector<bool> reached(num_instructions, false);
+	std::vector<int> visits(num_instructions, 0);
+	std::set<uint32_t> leaders;
+	std::set<uint32_t> pages;
+	
+	// registers start out unknown except the zero register
+	State entry;
+	entry.fill(Top());
+	entry[1] = Constant(0);
+	
+	states[0] = entry;
+	reached[0] = true;
+	leaders.insert(0);
+	
+	std::vector<unsigned int> worklist;
+	worklist.push_back(0);
+	
+	std::ostringstream reason;
+	std::ostringstream access_reason; // the first access that keeps the job from running unchecked
+	
+	while (!worklist.empty())
+	{
+		unsigned int index = worklist.back();
+		worklist.pop_back();
+		
+		uint32_t address = index * sizeof(types::Word);
+		const isa::Instruction instruction = isa::Decode(code[index]);
+		const isa::OpcodeInfo& info = isa::OPCODE_TABLE[instruction.opcode];
+		
+		if (info.name == NULL)
+		{
+			reason << "invalid opcode 0x" << std::hex << (int)instruction.opcode << " at 0x" << address;
+			report.reason = reason.str();
+			return report;
+		}
+		
+		pages.insert(Machine::PageOf(address));
+		
+		State state = states[index];
+		std::array<Interval, Machine::REGISTER_COUNT>& r = state;
+		
+		// the access this instruction makes, if any
+		bool accesses = false;
+		bool writes = false;
+		Interval access;
+		
+		switch (instruction.opcode)
+		{
+			case isa::RD:
+				accesses = true;
+				access = instruction.reg2 > 0 ? Truncate16(r[instruction.reg2]) : Constant(instruction.address);
+				r[instruction.reg1] = Top();
+				break;
+				
+			case isa::WR:
+				accesses = true;
+				writes = true;
+				access = instruction.address == 0 ? r[instruction.reg2] : Constant(instruction.address);
+				break;
+				
+			case isa::ST:
+				accesses = true;
+				writes = true;
+				access = Checked(r[instruction.reg2].lo + instruction.address, r[instruction.reg2].hi + instruction.address);
+				break;
+				
+			case isa::LW:
+				accesses = true;
+				access = Checked(r[instruction.reg1].lo + instruction.address, r[instruction.reg1].hi + instruction.address);
+				r[instruction.reg2] = Top();
+				break;
+				
+			case isa::MOV:
+				r[instruction.reg1] = r[instruction.reg2];
+				break;
+				
+			case isa::ADD:
+				r[instruction.reg3] = Checked(r[instruction.reg1].lo + r[instruction.reg2].lo, r[instruction.reg1].hi + r[instruction.reg2].hi);
+				break;
+				
+			case isa::SUB:
+				r[instruction.reg3] = r[instruction.reg1].lo >= r[instruction.reg2].hi ? Checked(r[instruction.reg1].lo - r[instruction.reg2].hi, r[instruction.reg1].hi - r[instruction.reg2].lo) : Top();
+				break;
+				
+			case isa::MUL:
+				r[instruction.reg3] = r[instruction.reg1].hi <= WORD_MAX / (r[instruction.reg2].hi + 1) ? Checked(r[instruction.reg1].lo * r[instruction.reg2].lo, r[instruction.reg1].hi * r[instruction.reg2].hi) : Top();
+				break;
+				
+			case isa::DIV:
+				if (r[instruction.reg2].hi == 0)
+				{
+					reason << "division by zero at 0x" << std::hex << address;
+					report.reason = reason.str();
+					return report;
+				}
+				
+				r[instruction.reg3] = r[instruction.reg2].lo > 0 ? Checked(r[instruction.reg1].lo / r[instruction.reg2].hi, r[instruction.reg1].hi / r[instruction.reg2].lo) : Checked(0, r[instruction.reg1].hi);
+				break;
+				
+			case isa::AND:
+				r[instruction.reg3] = Checked(0, std::min(r[instruction.reg1].hi, r[instruction.reg2].hi));
+				break;
+				
+			case isa::OR:
+				r[instruction.reg3] = Checked(std::max(r[instruction.reg1].lo, r[instruction.reg2].lo), BitCeiling(std::max(r[instruction.reg1].hi, r[instruction.reg2].hi)));
+				break;
+				
+			case isa::MOVI:
+			case isa::LDI:
+				r[instruction.reg2] = Constant(instruction.address);
+				break;
+				
+			case isa::LUI:
+				r[instruction.reg2] = Constant((types::Word)instruction.address << 16);
+				break;
+				
+			case isa::ADDI:
+				r[instruction.reg2] = Checked(r[instruction.reg2].lo + instruction.address, r[instruction.reg2].hi + instruction.address);
+				break;
+				
+			case isa::MULI:
+				r[instruction.reg2] = Checked(r[instruction.reg2].lo * instruction.address, r[instruction.reg2].hi * instruction.address);
+				break;
+				
+			case isa::DIVI:
+				if (instruction.address == 0)
+				{
+					reason << "division by zero at 0x" << std::hex << address;
+					report.reason = reason.str();
+					return report;
+				}
+				
+				r[instruction.reg2] = Checked(r[instruction.reg2].lo / instruction.address, r[instruction.reg2].hi / instruction.address);
+				break;
+				
+			case isa::SLT:
+				r[instruction.reg3] = Checked(0, 1);
+				break;
+				
+			case isa::SLTI:
+				r[instruction.reg2] = Checked(0, 1);
+				break;
+				
+			// the ranges are only known at run time. the count ends at 0 and the rest moved on
+			case isa::BCPY:
+			case isa::BFIL:
+			case isa::VADD:
+			case isa::VSUM:
+			case isa::VMIN:
+			case isa::VMAX:
+				accesses = true;
+				writes = instruction.opcode == isa::BCPY || instruction.opcode == isa::BFIL || instruction.opcode == isa::VADD;
+				access = Top();
+				
+				if (instruction.opcode != isa::BFIL)
+				{
+					r[instruction.reg1] = Top();
+				}
+				
+				r[instruction.reg2] = Top();
+				r[instruction.reg3] = Constant(0);
+				break;
+				
+			case isa::CSWP:
+				accesses = true;
+				writes = true;
+				access = Checked(r[instruction.reg1].lo + instruction.address, r[instruction.reg1].hi + instruction.address + sizeof(types::Word));
+				r[instruction.reg2] = Checked(0, 1);
+				break;
+		}
+		
+		if (accesses)
+		{
+			if (access.lo > last_word)
+			{
+				reason << "access outside the job at 0x" << std::hex << address;
+				report.reason = reason.str();
+				return report;
+			}
+			
+			// verified jobs run without access checks, so an address that might leave the image is not allowed
+			if (access.hi > last_word || IsTop(access))
+			{
+				if (access_reason.tellp() == 0)
+				{
+					access_reason << "access at 0x" << std::hex << address << " cannot be bounded inside the job";
+				}
+			}
+			// the code is fetched unchecked, a store into it could branch anywhere
+			else if (writes && access.lo < code_size)
+			{
+				if (access_reason.tellp() == 0)
+				{
+					access_reason << "store into the code at 0x" << std::hex << address;
+				}
+			}
+			else
+			{
+				for (uint32_t page = Machine::PageOf(access.lo); page <= Machine::PageOf(access.hi); page++)
+				{
+					pages.insert(page);
+				}
+			}
+		}
+		
+		// successors
+		std::vector<uint32_t> successors;
+		
+		if (info.branch)
+		{
+			uint32_t target = instruction.address;
+			
+			if (target % sizeof(types::Word) != 0 || target >= code_size)
+			{
+				reason << "branch at 0x" << std::hex << address << " to 0x" << target << " leaves the code";
+				report.reason = reason.str();
+				return report;
+			}
+			
+			successors.push_back(target);
+			leaders.insert(target);
+		}
+		
+		if (!info.ends_program && (!info.branch || info.conditional))
+		{
+			if (address + sizeof(types::Word) >= code_size)
+			{
+				reason << "execution runs off the end of the code at 0x" << std::hex << address;
+				report.reason = reason.str();
+				return report;
+			}
+			
+			successors.push_back(address + sizeof(types::Word));
+			
+			if (info.branch)
+			{
+				leaders.insert(address + sizeof(types::Word));
+			}
+		}
+		
+		for (int i = 0; i < successors.size(); i++)
+		{
+			unsigned int next = successors[i] / sizeof(types::Word);
+			
+			if (!reached[next])
+			{
+				reached[next] = true;
+				states[next] = state;
+				worklist.push_back(next);
+			}
+			else if (Join(states[next], state, ++visits[next] > WIDEN_AFTER))
+			{
+				worklist.push_back(next);
+			}
+		}
+	}
+	
+	report.control_flow = true;
+	report.verified = access_reason.tellp() == 0;
+	report.reason = access_reason.str();
+	report.block_leaders.assign(leaders.begin(), leaders.end());
+	report.footprint.assign(pages.begin(), pages.end());
+	
+	return report;
+}
+
+}
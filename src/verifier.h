@@ -0,0 +1,35 @@
+#ifndef VERIFIER_H
+#define VERIFIER_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "disk.h"
+#include "pcb.h"
+
+// load-time static analysis of a job's code section. builds the control-flow graph from the
+// job's entry point, checks every reachable instruction is valid, every branch and jump lands
+// on an instruction inside the code and execution never runs off the end of the code. an
+// interval analysis over the registers bounds the address of every memory access and rejects
+// divisions by a constant zero. a job is only verified if every access is proven inside its
+// image and no store can reach its code, so it can run without per-access page checks once
+// its footprint is resident. block instructions take their ranges at run time and are never
+// verified
+namespace verifier
+{
+
+struct Report
+{
+	bool verified;
+	bool control_flow; // the code checks passed, though the accesses may still keep it from being verified
+	std::string reason; // why the job was rejected
+	
+	std::vector<uint32_t> block_leaders; // logical addresses that start basic blocks, ascending
+	std::vector<uint32_t> footprint; // pages the job can touch, ascending, if it was verified
+};
+
+Report Verify(Disk& disk, PCB& job);
+
+}
+
+#endif // VERIFIER_H
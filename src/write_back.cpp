@@ -0,0 +1,88 @@
+#include "write_back.h"
+#include <algorithm>
+#include <iostream>
+#include "loader.h"
+
+bool WriteBack::ByDiskAddress(const Page& a, const Page& b)
+{
+	return a.disk_address < b.disk_address;
+}
+
+WriteBack::WriteBack(Disk& disk, unsigned int batch_pages)
+	: disk_(disk)
+{
+	batch_pages_ = batch_pages;
+	
+	pages_written_ = 0;
+	transfers_ = 0;
+}
+
+void WriteBack::Add(PCB* process, uint32_t page_num, const types::Word* words)
+{
+	Page page;
+	page.process = process;
+	page.page_num = page_num;
+	page.disk_address = process->disk_address + (page_num << Machine::FRAME_SHIFT);
+	page.words.assign(words, words + Machine::FRAME_WORDS);
+	
+	pending_.push_back(page);
+}
+
+bool WriteBack::Full()
+{
+	return pending_.size() >= batch_pages_;
+}
+
+bool WriteBack::Holds(PCB* process, uint32_t page_num)
+{
+	for (int i = 0; i < pending_.size(); i++)
+	{
+		if (pending_[i].process == process && pending_[i].page_num == page_num)
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+std::vector<IoRequest> WriteBack::Flush()
+{
+	std::vector<IoRequest> transfers;
+	
+	std::stable_sort(pending_.begin(), pending_.end(), ByDiskAddress);
+	
+	for (int i = 0; i < pending_.size(); i++)
+	{
+		loader::WritePageToDisk(disk_, pending_[i].process, pending_[i].page_num, pending_[i].words.data());
+		pages_written_++;
+		
+		uint32_t size = loader::PageBytes(pending_[i].process, pending_[i].page_num);
+		
+		// extends the previous transfer when it ends where this page starts
+		if (!transfers.empty() && transfers.back().disk_address + transfers.back().size == pending_[i].disk_address)
+		{
+			transfers.back().size += size;
+			continue;
+		}
+		
+		IoRequest transfer;
+		transfer.process = pending_[i].process;
+		transfer.page_num = pending_[i].page_num;
+		transfer.disk_address = pending_[i].disk_address;
+		transfer.size = size;
+		transfer.write = true;
+		
+		transfers.push_back(transfer);
+	}
+	
+	transfers_ += transfers.size();
+	pending_.clear();
+	
+	return transfers;
+}
+
+void WriteBack::PrintStatistics()
+{
+	std::cout << std::dec << "Write-back: " << pages_written_ << " dirty pages in " << transfers_ << " transfers" << std::endl;
+}
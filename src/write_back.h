@@ -0,0 +1,52 @@
+#ifndef WRITE_BACK_H
+#define WRITE_BACK_H
+
+#include <vector>
+#include <stdint.h>
+#include "disk.h"
+#include "disk_model.h"
+#include "pcb.h"
+#include "types.h"
+
+// dirty pages on their way back to their jobs' disk images. pages are held until the batch
+// fills up or a flush is forced, then written in disk address order with runs of adjacent
+// pages coalesced into single transfers
+class WriteBack
+{
+private:
+	struct Page
+	{
+		PCB* process;
+		uint32_t page_num;
+		uint32_t disk_address;
+		std::vector<types::Word> words;
+	};
+	
+	static bool ByDiskAddress(const Page& a, const Page& b);
+	
+	Disk& disk_;
+	unsigned int batch_pages_;
+	std::vector<Page> pending_;
+	
+	// statistics
+	unsigned long pages_written_;
+	unsigned long transfers_;
+	
+public:
+	WriteBack(Disk& disk, unsigned int batch_pages);
+	
+	// queues a page's Machine::FRAME_WORDS words
+	void Add(PCB* process, uint32_t page_num, const types::Word* words);
+	
+	bool Full();
+	
+	// a queued page has to reach the disk before the page is read back
+	bool Holds(PCB* process, uint32_t page_num);
+	
+	// writes everything queued. returns the coalesced transfers, for the disk model to time
+	std::vector<IoRequest> Flush();
+	
+	void PrintStatistics();
+};
+
+#endif // WRITE_BACK_H
@@ -0,0 +1,97 @@
+// the verifier only lets a job run unchecked if every access is proven inside its image and
+// nothing can store into its code. jobs that fail either way still get their control flow checked.
+// build from the repository root:
+// g++ -std=c++20 -O2 -pthread -Isrc tests/verifier_test.cpp $(ls src/*.cpp | grep -v main.cpp) -o verifier_test
+#include <iostream>
+#include <string>
+#include <vector>
+#include "disk.h"
+#include "isa.h"
+#include "verifier.h"
+
+static int failures = 0;
+
+static void Expect(bool condition, const char* what)
+{
+	if (!condition)
+	{
+		std::cout << "FAILED: " << what << std::endl;
+		failures++;
+	}
+}
+
+// writes the job's code and data words to the start of the disk and verifies it
+static verifier::Report Verify(const std::vector<std::string>& code, const std::vector<types::Word>& data)
+{
+	Disk disk(Machine::DISK_SIZE);
+	uint32_t address = 0;
+	
+	for (int i = 0; i < code.size(); i++)
+	{
+		types::Word word;
+		
+		if (!isa::Assemble(code[i], word))
+		{
+			std::cout << "FAILED: cannot assemble " << code[i] << std::endl;
+			failures++;
+		}
+		
+		disk.Write(address, &word, sizeof(word));
+		address += sizeof(word);
+	}
+	
+	for (int i = 0; i < data.size(); i++)
+	{
+		disk.Write(address, &data[i], sizeof(data[i]));
+		address += sizeof(data[i]);
+	}
+	
+	PCB job;
+	job.disk_address = 0;
+	job.input_buffer_offset = code.size() * sizeof(types::Word);
+	job.output_buffer_offset = address;
+	job.temp_buffer_offset = address;
+	job.program_size = address;
+	
+	return verifier::Verify(disk, job);
+}
+
+int main()
+{
+	types::Word jump;
+	isa::Assemble("JMP 0x1000", jump);
+	
+	// loads and stores at constant addresses in the data
+	verifier::Report report = Verify({"LW r1, r5, 0x10", "ST r5, r1, 0x14", "HLT"}, {0, 1, 2});
+	Expect(report.verified && report.control_flow, "constant data accesses are verified");
+	Expect(report.footprint == std::vector<uint32_t>({0, 1}), "the footprint holds the code and data pages");
+	
+	// the stored word becomes the instruction at 0xC
+	report = Verify({"LW r1, r5, 0x10", "ST r5, r1, 0xc", "NOP", "HLT"}, {jump});
+	Expect(!report.verified, "a store into the code is rejected");
+	Expect(report.control_flow, "a store into the code still has its control flow checked");
+	Expect(report.reason.find("store into the code") != std::string::npos, "the code store is the reason");
+	
+	report = Verify({"LW r1, r5, 0xc", "WR r5, r1, 0x4", "HLT"}, {0});
+	Expect(!report.verified, "a write into the code is rejected");
+	
+	// an address read from the input could be anything
+	report = Verify({"RD r5, r0, 0xc", "LW r5, r6, 0x0", "HLT"}, {0});
+	Expect(!report.verified, "an unbounded load is rejected");
+	Expect(report.reason.find("cannot be bounded") != std::string::npos, "the unbounded load is the reason");
+	
+	report = Verify({"LDI r0, r2, 0x10", "LDI r0, r4, 0x8", "BFIL r1, r2, r4", "HLT"}, {0, 0, 0, 0});
+	Expect(!report.verified && report.control_flow, "a block fill is rejected");
+	
+	report = Verify({"LW r1, r5, 0x100", "HLT"}, {0});
+	Expect(!report.verified && !report.control_flow, "an access past the image is rejected");
+	
+	report = Verify({"JMP 0x100", "HLT"}, {0});
+	Expect(!report.verified && !report.control_flow, "a branch out of the code is rejected");
+	
+	report = Verify({"NOP"}, {0});
+	Expect(!report.verified && !report.control_flow, "running off the end of the code is rejected");
+	
+	std::cout << (failures == 0 ? "verifier_test passed" : "verifier_test failed") << std::endl;
+	return failures == 0 ? 0 : 1;
+}
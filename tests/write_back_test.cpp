@@ -0,0 +1,69 @@
+// job images sit back to back on disk and do not start on frame boundaries. writing back the
+// last page of one job must leave the start of the next one alone.
+// build from the repository root:
+// g++ -std=c++20 -O2 -pthread -Isrc tests/write_back_test.cpp $(ls src/*.cpp | grep -v main.cpp) -o write_back_test
+#include <iostream>
+#include "disk.h"
+#include "loader.h"
+#include "write_back.h"
+
+static int failures = 0;
+
+static void Expect(bool condition, const char* what)
+{
+	if (!condition)
+	{
+		std::cout << "FAILED: " << what << std::endl;
+		failures++;
+	}
+}
+
+int main()
+{
+	Disk disk(Machine::DISK_SIZE);
+	
+	// 6 words, so its second page ends half way through the frame the next job starts in
+	PCB first;
+	first.disk_address = 0;
+	first.program_size = 6 * sizeof(types::Word);
+	
+	PCB second;
+	second.disk_address = first.program_size;
+	second.program_size = 8 * sizeof(types::Word);
+	
+	for (uint32_t i = 0; i < 14; i++)
+	{
+		types::Word word = 0x100 + i;
+		disk.Write(i * sizeof(types::Word), &word, sizeof(word));
+	}
+	
+	WriteBack write_back(disk, 8);
+	types::Word words[Machine::FRAME_WORDS];
+	
+	for (unsigned int i = 0; i < Machine::FRAME_WORDS; i++)
+	{
+		words[i] = 0xAA00 + i;
+	}
+	
+	write_back.Add(&first, 1, words);
+	std::vector<IoRequest> transfers = write_back.Flush();
+	
+	types::Word word;
+	
+	for (uint32_t i = 4; i < 6; i++)
+	{
+		disk.Read(i * sizeof(types::Word), &word, sizeof(word));
+		Expect(word == 0xAA00 + i - 4, "the first job's last page is written back");
+	}
+	
+	for (uint32_t i = 6; i < 14; i++)
+	{
+		disk.Read(i * sizeof(types::Word), &word, sizeof(word));
+		Expect(word == 0x100 + i, "the second job's image is untouched");
+	}
+	
+	Expect(transfers.size() == 1 && transfers[0].size == 2 * sizeof(types::Word), "the transfer ends with the image");
+	
+	std::cout << (failures == 0 ? "write_back_test passed" : "write_back_test failed") << std::endl;
+	return failures == 0 ? 0 : 1;
+}